@@ -67,6 +67,7 @@ typedef struct s_redir
  * - minishell: Pointer to the main shell state/context.
  * - redirs:    List of redirections associated with
  * this command (t_list of t_redir*).
+ * - background: The pipeline ends with `&` (set on its first command).
  *
  * Example pipeline: `ls -l | grep minishell | wc -l`
  * - cmd1: "ls -l"
@@ -81,13 +82,14 @@ typedef struct s_cmd
 	t_mshell			*minishell;
 	t_list				*redirs;
 	t_cmd				*origin_head;
+	bool				background;
 }						t_cmd;
 
 void					heredoc_sigint_handler(int sig);
 void					setup_heredoc_signals(void);
-int						run_heredoc_child(int pipe_fd, const char *delim,
-							t_mshell *mshell, int expand_flag);
-int						write_heredoc_line(int pipe_fd, const char *line);
+void					restore_heredoc_signals(void);
+int						write_heredoc_line(t_heredoc_ctx *ctx,
+							const char *line);
 int						read_next_heredoc_line(char **line,
 							const char *delimiter);
 
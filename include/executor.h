@@ -13,8 +13,22 @@
 #ifndef EXECUTOR_H
 # define EXECUTOR_H
 
-// Maximum number of commands in a pipeline.
-# define MAX_CMDS 1000
+// File descriptors the parent holds while starting a pipeline stage:
+// the previous stage's read end and the current pipe.
+# define PIPE_FD_RESERVE 3
+// Largest pipe buffer assumed when `/proc/sys/fs/pipe-max-size` is unreadable.
+# define PIPE_DEFAULT_MAX 1048576
+// Size of the builtin output buffer.
+# define WBUF_SIZE 4096
+// Heredoc body buffer; bodies that fit are written to a pipe in one go.
+# define HEREDOC_BUF_SIZE 65536
+// Spawn helper: fds passed with one request (stdin, stdout, stderr, cwd
+// and heredocs), room for their control message, and request flags.
+# define SPAWN_MAX_FDS 16
+# define SPAWN_CTRL_WORDS 16
+# define SPAWN_JOB_CONTROL 1
+# define SPAWN_FOREGROUND 2
+# define SPAWN_BG_CHILD 4
 
 /*------FORWARD DECLARATIONS-----------------------------------------*/
 
@@ -25,6 +39,9 @@ typedef struct s_hash_table			t_hash_tbl;
 typedef enum e_redir_type			t_redir_type;
 typedef struct s_redir				t_redir;
 typedef struct s_builtin_dispatch	t_builtin_disp;
+typedef struct s_job				t_job;
+typedef struct s_job_tbl			t_job_tbl;
+typedef enum e_job_state			t_job_state;
 
 typedef struct s_exit_info
 {
@@ -37,32 +54,109 @@ typedef struct s_exit_info
 	t_cmd		*origin_head;
 }	t_exit_info;
 
+/**
+ * State of a running pipeline: `pids` and `statuses` hold one slot per
+ * stage, `count` is the number of stages started and `start` the time
+ * the pipeline was set up, used to report when each stage ended.
+ * Under job control `pgid` is the process group of the pipeline (0 until
+ * its first stage starts). `stop_sig` is set when a foreground stage
+ * was stopped. `deferred` is set when the first stage is a builtin run
+ * by the shell itself (its pid is 0, never under job control);
+ * `builtin_fd` is then the write end it prints to, until it has run.
+ */
 typedef struct s_pipe_info
 {
-	int		in_fd;
-	int		*pipe_fd;
-	pid_t	*pids;
-	int		*idx;
-	t_cmd	*cmd_list;
+	int				in_fd;
+	int				*pipe_fd;
+	pid_t			*pids;
+	uint8_t			*statuses;
+	size_t			count;
+	struct timespec	start;
+	t_cmd			*cmd_list;
+	pid_t			pgid;
+	bool			background;
+	int				stop_sig;
+	int				builtin_fd;
+	bool			deferred;
 }	t_pipe_info;
 
+/**
+ * A heredoc being read. Its body collects in `buf` (`len` bytes); a body
+ * that outgrows it continues in a file (`file_fd`, -1 until then), one
+ * that fits goes to a pipe once complete. A `discard`ed body is only
+ * read past.
+ */
 typedef struct s_heredoc_ctx
 {
-	int			pipe_fd;
+	int			pipe_fd[2];
+	int			file_fd;
 	const char	*delim;
 	t_mshell	*mshell;
 	int			expand;
-	size_t		*total;
+	bool		discard;
+	size_t		len;
+	char		buf[HEREDOC_BUF_SIZE];
 }	t_heredoc_ctx;
 
-typedef struct s_heredoc_exec_ctx
+/**
+ * A request to the spawn helper, sent ahead of `len` bytes of strings:
+ * the binary, `argc` arguments, `envc` environment entries, then for
+ * each of the `nredir` redirections its type byte and file name. Heredoc
+ * redirections have an empty name and take the next of the `nfds` fds,
+ * after stdin, stdout, stderr and the working directory. `pgid` and
+ * `flags` (`SPAWN_*`) set up the stage like `setup_child_signals()`.
+ */
+typedef struct s_spawn_req
 {
-	t_cmd		*cmd;
-	const char	*delim;
-	t_cmd		*current;
-	t_cmd		*full_cmd_list;
-	int			*pipe_fd;
-}	t_heredoc_exec_ctx;
+	size_t	len;
+	int		argc;
+	int		envc;
+	int		nredir;
+	int		nfds;
+	pid_t	pgid;
+	int		flags;
+}	t_spawn_req;
+
+/**
+ * The helper's answer: the pid of the started stage, and `err`, the
+ * `errno` of a failed `execve()` or of a failure to start it at all
+ * (`pid` is then -1). A stage that failed to exec is still a zombie
+ * child of the shell.
+ */
+typedef struct s_spawn_reply
+{
+	pid_t	pid;
+	int		err;
+}	t_spawn_reply;
+
+/**
+ * A request as the helper unpacked it; every pointer points into `buf`
+ * or into the two arrays allocated for it.
+ */
+typedef struct s_spawn_ctx
+{
+	t_spawn_req	req;
+	int			fds[SPAWN_MAX_FDS];
+	char		*buf;
+	char		*binary;
+	char		**argv;
+	char		**envp;
+	t_redir		*redirs;
+	t_list		*nodes;
+}	t_spawn_ctx;
+
+/**
+ * Output buffer for builtins: bytes are collected in `data` and written
+ * to `fd` in as few `write()` calls as possible. After a failed write
+ * `failed` is set and further output is dropped.
+ */
+typedef struct s_wbuf
+{
+	int		fd;
+	size_t	len;
+	bool	failed;
+	char	data[WBUF_SIZE];
+}	t_wbuf;
 
 /*------FUNCTIONS---------------------------------------------------*/
 
@@ -75,14 +169,25 @@ void					update_underscore(t_cmd *cmd, char *binary_path);
 
 // parent process
 uint8_t					exec_in_current_process(t_cmd *cmd);
+void					exec_in_place(t_cmd *cmd);
 
 // pipes
 uint8_t					exec_in_pipes(t_cmd *cmd);
 void					execute_command(t_cmd *cmd);
 // void					handle_child_and_track(t_cmd *cmd,
 //t_pipe_info *info, int level);
-void					handle_child_and_track(t_cmd *cmd, t_pipe_info *info);
-uint8_t					wait_for_children(pid_t *pids, int count);
+uint8_t					handle_child_and_track(t_cmd *cmd, t_pipe_info *info);
+bool					spawn_and_track(t_cmd *cmd, t_pipe_info *info);
+bool					defer_builtin(t_cmd *cmd, t_pipe_info *info);
+void					apply_pipe_size(t_mshell *mshell, int fd);
+void					run_deferred_stage(t_pipe_info *info);
+uint8_t					wait_for_children(t_pipe_info *info);
+uint8_t					child_status(int status, bool report);
+void					log_stage_end(t_pipe_info *info, size_t stage);
+uint8_t					stages_status(const uint8_t *statuses, size_t count,
+							bool pipefail);
+int						set_pipestatus(t_mshell *mshell,
+							const uint8_t *statuses, size_t count);
 uint8_t					close_unused_fds(int in_fd, int *pipe_fd);
 
 // pipe utils
@@ -91,11 +196,15 @@ uint8_t					validate_dots(t_cmd *cmd);
 uint8_t					update_shlvl(t_cmd *cmd);
 void					handle_empty_command(t_cmd *cmd);
 uint8_t					close_unused_fds(int in_fd, int *pipe_fd);
-void					handle_pipe_creation(t_cmd *cmd, int *pipe_fd);
+uint8_t					handle_pipe_creation(t_cmd *cmd, int *pipe_fd);
+int						pipe_cloexec(int *pipe_fd);
 void					close_fds_and_prepare_next(t_cmd *cmd, int *in_fd,
 							int *pipe_fd);
-void					init_pipe_info(t_pipe_info *info, t_cmd *cmd_list,
-							int pipe_fd[2], pid_t pids[MAX_CMDS]);
+uint8_t					init_pipe_info(t_pipe_info *info, t_cmd *cmd_list,
+							int pipe_fd[2]);
+void					abort_pipeline(t_pipe_info *info);
+size_t					count_pipeline_stages(t_cmd *cmd_list);
+uint8_t					check_fd_budget(t_cmd *cmd_list);
 
 // builtin
 const t_builtin_disp	*get_builtin_table(size_t *size);
@@ -122,7 +231,63 @@ uint8_t					handle_env(t_cmd *cmd);
 // export
 uint8_t					handle_export(t_cmd *cmd);
 int						handle_sorted_env(t_mshell *mshell);
-int						collect_keys(t_hash_tbl *ht, char ***keys, int *count);
+
+// builtin output buffer
+void					wbuf_init(t_wbuf *wb, int fd);
+void					wbuf_write(t_wbuf *wb, const char *s, size_t n);
+void					wbuf_puts(t_wbuf *wb, const char *s);
+int						wbuf_flush(t_wbuf *wb);
+uint8_t					wbuf_error(const char *msg);
+
+// hash
+uint8_t					handle_hash(t_cmd *cmd);
+uint8_t					handle_set(t_cmd *cmd);
+uint8_t					handle_jobs(t_cmd *cmd);
+uint8_t					handle_fg(t_cmd *cmd);
+uint8_t					handle_bg(t_cmd *cmd);
+uint8_t					handle_wait(t_cmd *cmd);
+
+// jobs
+void					init_job_info(t_pipe_info *info, t_cmd *cmd_list);
+uint8_t					start_job(t_pipe_info *info);
+uint8_t					finish_pipeline(t_pipe_info *info);
+void					give_terminal(t_mshell *mshell, pid_t pgid);
+void					track_stage(t_pipe_info *info, pid_t pid);
+void					setup_child_signals(t_mshell *mshell,
+							t_pipe_info *info);
+void					child_default_signals(sigset_t *set,
+							t_pipe_info *info);
+
+// spawn helper
+void					start_spawn_helper(t_mshell *mshell);
+void					stop_spawn_helper(t_mshell *mshell);
+bool					helper_spawn(t_cmd *cmd, t_pipe_info *info);
+char					*pack_spawn_req(t_cmd *cmd, t_pipe_info *info,
+							t_spawn_req *req, int *fds);
+void					spawn_helper_main(int sock);
+bool					unpack_spawn_req(t_spawn_ctx *ctx);
+void					spawn_helper_child(t_spawn_ctx *ctx, int err_fd);
+bool					read_full(int fd, void *buf, size_t len);
+bool					send_full(int sock, const void *buf, size_t len);
+t_job					*job_add(t_mshell *mshell, t_pipe_info *info,
+							t_job_state state);
+void					job_remove(t_mshell *mshell, t_job *job);
+void					jobs_free(t_job_tbl *tbl);
+char					*job_cmdline(t_cmd *cmd);
+t_job					*job_find_pid(t_job_tbl *tbl, pid_t pid,
+							size_t *stage);
+void					job_note_status(t_mshell *mshell, pid_t pid,
+							int status);
+void					poll_jobs(t_mshell *mshell);
+void					reap_jobs(t_mshell *mshell);
+uint8_t					wait_for_job(t_mshell *mshell, t_job *job);
+uint8_t					job_status(t_mshell *mshell, t_job *job);
+uint8_t					wait_all_jobs(t_mshell *mshell);
+t_job					*job_from_spec(t_mshell *mshell, const char *spec,
+							const char *name);
+void					put_job(t_wbuf *wb, t_mshell *mshell, t_job *job);
+const char				*job_mark(t_mshell *mshell, t_job *job);
+uint8_t					print_cmd_table(t_mshell *mshell, bool reusable);
 
 // unset
 uint8_t					handle_unset(t_cmd *cmd);
@@ -142,22 +307,20 @@ uint8_t					apply_redirections(t_cmd *cmd);
 
 // heredoc <<
 uint8_t					apply_heredocs(t_cmd *cmd);
-bool					heredoc_exceeds_limit(size_t total_written);
 bool					is_heredoc(t_redir *redirection);
+t_redir					*last_input_redir(t_list *redirs);
 void					close_all_heredoc_fds(t_cmd *cmd_list);
-int						write_heredoc_to_pipe(t_cmd *cmd,
-							int pipe_fd, const char *delim);
-void					close_unused_heredocs_child(t_cmd *current,
-							t_cmd *full_cmd_list);
+int						write_heredoc_to_pipe(t_heredoc_ctx *ctx);
+int						heredoc_writev(int fd, struct iovec *iov, int cnt);
+int						expand_heredoc_line(t_heredoc_ctx *ctx, char *line);
 int						handle_heredoc_redirection(t_redir *r);
-t_redir					*find_redir_by_delim(t_list *redirs,
-							const char *delim);
-int						handle_heredoc_parent(pid_t pid, int *pipe_fd,
-							t_cmd *full_cmd_list);
-void					handle_heredoc_child(t_heredoc_exec_ctx ctx);
+int						heredoc_put(t_heredoc_ctx *ctx,
+							const char *s, size_t n);
+int						finish_heredoc(t_heredoc_ctx *ctx);
+int						open_heredoc_file(void);
+int						seal_heredoc_file(int fd);
 
 // utils
-t_mshell_var			*split_key_value(char *key_value_pair);
 void					safe_close(int *fd);
 
 // exit utils
@@ -165,7 +328,7 @@ int						perror_return(const char *msg, int exit_status);
 uint8_t					perror_exit_child(t_cmd *cmd,
 							const char *msg, u_int8_t exit_status);
 void					cmd_missing_command_error(t_cmd *cmd);
-void					export_error(t_mshell_var *pair);
+void					export_error(const char *arg);
 u_int8_t				unset_error(const char *str);
 int						error_return(const char *msg, int exit_status);
 uint8_t					no_cmd_error(const char *msg);
@@ -28,6 +28,11 @@
 # include <stdint.h>
 # include <limits.h>
 # include <sys/stat.h>
+# include <sys/resource.h>
+# include <sys/uio.h>
+# include <time.h>
+# include <dirent.h>
+# include <spawn.h>
 # include <string.h>
 # include "libft.h"
 # include "executor.h"
@@ -39,8 +44,25 @@
 // limits
 # define ERROR_BUF_SIZE 128
 # define MS_PATHMAX 4096
-# define HASH_SIZE 128
-# define HEREDOC_MAX_SIZE 65536
+# define HT_MIN_CAP 64
+# define CMD_TBL_MIN_CAP 32
+# define ENV_MIN_CAP 16
+# define PATH_MISS_SLOTS 64
+# define PATH_INDEX_MIN_CAP 1024
+
+// PATH directories are kept open for *at() lookups; O_PATH where available
+# ifdef O_PATH
+#  define PATH_DIR_FLAGS O_PATH
+# else
+#  define PATH_DIR_FLAGS O_RDONLY
+# endif
+
+// nanosecond modification time field of struct stat
+# ifdef __APPLE__
+#  define ST_MTIM st_mtimespec
+# else
+#  define ST_MTIM st_mtim
+# endif
 # define CMD_MAX_SIZE 16384
 
 // errors
@@ -66,41 +88,339 @@ typedef struct s_builtin_dispatch
  * @struct	s_mshell_var
  * @brief	Represents a single environment variable in minishell.
  *
- * - `key`:			The key of the environment variable (e.g., "PATH").
- * - `value`:		The value associated with the variable
- * (e.g., "/usr/bin:/bin").
+ * The name and value share one `KEY=VALUE` buffer, which is also the
+ * string exported through `t_mshell->env`.
+ *
+ * - `key`:			Start of the buffer (e.g., "PATH=/usr/bin:/bin").
+ * 	The name is not NUL-terminated when a value is assigned.
+ * - `key_len`:		Length of the name (e.g., 4 for "PATH").
+ * - `value`:		View of the value inside the buffer
+ * (e.g., "/usr/bin:/bin"), or NULL if no value is assigned.
  * - `val_assigned`:	Indicates if the variable has value (1) or not (0).
- * - `next`:		Pointer to the next variable in the
- * 	linked list (for handling collisions in hash table).
+ * - `gen`:			Value of `t_mshell->env_gen` when the variable was
+ * 	last set.
+ * - `env_idx`:		Slot of the variable in `t_mshell->env`,
+ * 	or -1 if the variable is not exported.
  */
 typedef struct s_mshell_var
 {
 	char				*key;
+	size_t				key_len;
 	char				*value;
 	int					val_assigned;
-	struct s_mshell_var	*next;
+	unsigned long		gen;
+	int					env_idx;
 }						t_mshell_var;
 
+/**
+ * @struct	s_ht_slot
+ * @brief	One slot of the variable hash table.
+ *
+ * - `hash`:	Full hash of the key, compared before the key itself.
+ * - `key_len`:	Length of the key.
+ * - `var`:		Variable stored in the slot, or NULL if the slot is free.
+ */
+typedef struct s_ht_slot
+{
+	unsigned int		hash;
+	size_t				key_len;
+	t_mshell_var		*var;
+}						t_ht_slot;
+
 /**
  * @struct	s_hash_table
  * @brief	Represents the hash table for environment variables.
  *
- * - `buckets`:	An array of linked lists (chained hashing) for
- * 				storing environment variables.
- *				The index in the array is determined by a hash function.
+ * Open addressing with linear probing. The table doubles once it is
+ * three quarters full. Alongside the slots it keeps every variable
+ * ordered by name, so listing them sorted needs no copy or sort.
+ *
+ * - `slots`:		Array of `cap` slots, `cap` is a power of two.
+ * - `cap`:			Number of slots.
+ * - `count`:		Number of used slots.
+ * - `order`:		The `count` variables sorted by name.
+ * - `order_cap`:	Number of allocated `order` entries.
+ * - `order_dirty`:	Set while importing the environment: `order` is only
+ * 	appended to and gets sorted once by `ht_order_sort()`.
  */
 typedef struct s_hash_table
 {
-	t_mshell_var		*buckets[HASH_SIZE];
+	t_ht_slot			*slots;
+	size_t				cap;
+	size_t				count;
+	t_mshell_var		**order;
+	size_t				order_cap;
+	bool				order_dirty;
 }						t_hash_tbl;
 
+/**
+ * @struct	s_var_cache
+ * @brief	Remembers one variable for code that caches data derived from it.
+ *
+ * Checked with `var_cache_changed()`: while `t_mshell->env_gen` has not
+ * moved, nothing is looked up at all.
+ *
+ * - `key`:		Name of the variable.
+ * - `env_gen`:	`t_mshell->env_gen` at the last check, 0 before the first.
+ * - `var_gen`:	Generation of the variable at the last check, 0 if unset.
+ * - `value`:	Current value of the variable, or NULL if it is unset.
+ */
+typedef struct s_var_cache
+{
+	const char			*key;
+	unsigned long		env_gen;
+	unsigned long		var_gen;
+	char				*value;
+}						t_var_cache;
+
+/**
+ * @struct	s_path_dir
+ * @brief	One non-empty `PATH` entry.
+ *
+ * - `dir`:	Start of the entry inside the `PATH` value (not NUL-terminated).
+ * - `len`:	Length of the entry.
+ * - `fd`:	Directory fd for absolute entries, opened on first use;
+ *			-1 while not open.
+ * - `dev`, `ino`, `mtime`:	Directory state when the miss cache was
+ *			started (all zero if it did not exist).
+ * - `missing`:	The directory did not exist when the index was built.
+ */
+typedef struct s_path_dir
+{
+	const char			*dir;
+	size_t				len;
+	int					fd;
+	dev_t				dev;
+	ino_t				ino;
+	struct timespec		mtime;
+	bool				missing;
+}						t_path_dir;
+
+/**
+ * @struct	s_pidx_slot
+ * @brief	One name in the `PATH` index.
+ *
+ * - `hash`:		Hash of the name.
+ * - `name_len`:	Length of the name; 0 for a free slot.
+ * - `name_off`:	Offset of the NUL-terminated name in `names`.
+ * - `dir`:			Index of the first `PATH` directory holding the name.
+ */
+typedef struct s_pidx_slot
+{
+	unsigned int		hash;
+	unsigned int		name_len;
+	size_t				name_off;
+	size_t				dir;
+}						t_pidx_slot;
+
+/**
+ * @struct	s_path_index
+ * @brief	Every name found in the `PATH` directories, kept fresh with
+ *			inotify (interactive shells only).
+ *
+ * - `enabled`:	The index may be used (set for interactive sessions).
+ * - `valid`:	The index matches the directories.
+ * - `failed`:	Building failed for the current `PATH`; probe instead.
+ * - `read_only`:	Set in pipeline children: use the index as inherited,
+ *				never drain the shared watch or rebuild.
+ * - `watch_fd`:	inotify instance watching the directories, or -1.
+ * - `slots`:	`cap` open-addressing slots holding `count` names.
+ * - `names`:	Arena of NUL-terminated names (`names_len` of
+ *				`names_cap` bytes used).
+ */
+typedef struct s_path_index
+{
+	bool				enabled;
+	bool				valid;
+	bool				failed;
+	bool				read_only;
+	int					watch_fd;
+	t_pidx_slot			*slots;
+	size_t				cap;
+	size_t				count;
+	char				*names;
+	size_t				names_len;
+	size_t				names_cap;
+}						t_path_index;
+
+/**
+ * @struct	s_path_cache
+ * @brief	`PATH` split into directories, rebuilt only when `PATH` changes.
+ *
+ * - `var`:		Cache of the `PATH` variable itself.
+ * - `dirs`:	The `count` non-empty entries, in order.
+ * - `count`:	Number of entries in `dirs`.
+ * - `cap`:		Number of allocated `dirs` entries.
+ * - `misses`:	Names found in no directory, indexed by hash; a newer
+ *				name replaces an older one on collision.
+ * - `miss_count`:	Number of names in `misses`.
+ * - `any_candidate`:	Set by `search_paths()` when a failed search saw
+ *				a file of that name (not executable) in some directory.
+ * - `index`:	Optional name index of the directories.
+ */
+typedef struct s_path_cache
+{
+	t_var_cache			var;
+	t_path_dir			*dirs;
+	size_t				count;
+	size_t				cap;
+	char				*misses[PATH_MISS_SLOTS];
+	size_t				miss_count;
+	bool				any_candidate;
+	t_path_index		index;
+}						t_path_cache;
+
+/**
+ * @struct	s_cmd_entry
+ * @brief	One remembered command in the command table.
+ *
+ * - `path`:		Heap-allocated absolute path, NULL for a free slot.
+ * - `name`:		Command name; points at the last component of `path`.
+ * - `name_len`:	Length of `name`.
+ * - `hash`:		Hash of `name`.
+ * - `hits`:		Number of times the entry was used.
+ */
+typedef struct s_cmd_entry
+{
+	char				*path;
+	const char			*name;
+	size_t				name_len;
+	unsigned int		hash;
+	unsigned long		hits;
+}						t_cmd_entry;
+
+/**
+ * @struct	s_cmd_tbl
+ * @brief	Command names resolved through `PATH` (see the `hash` builtin).
+ *
+ * Open addressing with linear probing, like the variable table. It is
+ * emptied whenever `PATH` changes.
+ *
+ * - `slots`:	`cap` entries, allocated on the first insertion.
+ * - `count`:	Number of remembered commands.
+ * - `hits`:	Lookups answered from the table.
+ * - `misses`:	Lookups that had to search `PATH`.
+ */
+typedef struct s_cmd_tbl
+{
+	t_cmd_entry			*slots;
+	size_t				cap;
+	size_t				count;
+	unsigned long		hits;
+	unsigned long		misses;
+}						t_cmd_tbl;
+
+typedef enum e_job_state
+{
+	JOB_RUNNING,
+	JOB_STOPPED,
+	JOB_DONE
+}						t_job_state;
+
+/**
+ * @struct	s_job
+ * @brief	A pipeline started with `&`, or stopped while in the foreground.
+ *
+ * - `id`:			Job number, as in `%1`.
+ * - `pgid`:		Process group of the job, or 0 without job control.
+ * - `pids`:		One process ID per stage; negated once the stage is reaped.
+ * - `statuses`:	Exit status of each reaped stage.
+ * - `count`:		Number of stages.
+ * - `live`:		Number of stages not reaped yet.
+ * - `state`:		Running, stopped or done.
+ * - `changed`:		The state changed since it was last reported.
+ * - `cmdline`:		Command text shown by `jobs`.
+ */
+typedef struct s_job
+{
+	int					id;
+	pid_t				pgid;
+	pid_t				*pids;
+	uint8_t				*statuses;
+	size_t				count;
+	size_t				live;
+	t_job_state			state;
+	bool				changed;
+	char				*cmdline;
+}						t_job;
+
+/**
+ * @struct	s_job_tbl
+ * @brief	Jobs of the shell, ordered by job number.
+ *
+ * The last job is the current one (`%+`), the one before it the
+ * previous one (`%-`).
+ */
+typedef struct s_job_tbl
+{
+	t_job				*jobs;
+	size_t				count;
+	size_t				cap;
+}						t_job_tbl;
+
+/**
+ * @struct	s_mshell
+ * @brief	Global shell state.
+ *
+ * - `env`:			NULL-terminated `KEY=VALUE` array passed to `execve()`.
+ * - `env_vars`:	Owner of each `env` slot, used to move the last slot
+ * 	into a hole when a variable leaves the environment.
+ * - `env_count`:	Number of used `env` slots.
+ * - `env_cap`:		Number of allocated `env` slots (without the NULL).
+ * - `hash_table`:	Table of all shell variables.
+ * - `env_gen`:		Environment generation, bumped whenever a variable
+ * 	is set or unset.
+ * - `home_cache`:	Cached `HOME`, used by tilde expansion.
+ * - `shlvl_cache`:	Cached `SHLVL`, parsed into `shlvl`.
+ * - `path_cache`:	`PATH` split into directories.
+ * - `cmd_table`:	Commands already found through `PATH`.
+ * - `exec_last`:	The command line being run is the last one, so a single
+ * 	external command replaces the shell instead of being forked.
+ * - `pipestatus`:	Statuses of the stages of the last foreground command,
+ * 	space separated; expanded by `$PIPESTATUS`, never exported.
+ * - `pipefail`:	`set -o pipefail`: a pipeline returns the status of its
+ * 	last failing stage instead of the status of its last stage.
+ * - `pipe_cache`:	Cached `MINISHELL_PIPESIZE`, parsed into the two
+ * 	fields below.
+ * - `pipe_size`:	Buffer size given to every pipe between stages, 0 to
+ * 	keep the system default.
+ * - `pipe_max`:	Largest pipe buffer allowed (`/proc/sys/fs/pipe-max-size`).
+ * - `spawn_fd`:	Socket to the spawn helper started with
+ * 	`MINISHELL_SPAWN_HELPER` set, or -1 (see `spawn_helper.c`).
+ * - `jobs`:		Background and stopped jobs.
+ * - `job_control`:	The shell owns its terminal: every pipeline gets its
+ * 	own process group and the foreground one gets the terminal.
+ * - `shell_pgid`:	Process group of the shell, given the terminal back.
+ * - `bg_child`:	Set in the children of a background job started without
+ * 	job control, which ignore SIGINT and SIGQUIT.
+ */
 typedef struct s_mshell
 {
 	char				**env;
+	t_mshell_var		**env_vars;
+	size_t				env_count;
+	size_t				env_cap;
 	t_hash_tbl			*hash_table;
+	unsigned long		env_gen;
+	t_var_cache			home_cache;
+	t_var_cache			shlvl_cache;
+	int					shlvl;
+	t_path_cache		path_cache;
+	t_cmd_tbl			cmd_table;
 	uint8_t				exit_status;
 	uint8_t				syntax_exit_status;
 	bool				allocation_error;
+	bool				exec_last;
+	char				*pipestatus;
+	bool				pipefail;
+	t_var_cache			pipe_cache;
+	int					pipe_size;
+	int					pipe_max;
+	int					spawn_fd;
+	t_job_tbl			jobs;
+	bool				job_control;
+	pid_t				shell_pgid;
+	bool				bg_child;
 }						t_mshell;
 // run progrmm
 
@@ -118,19 +438,14 @@ uint8_t			run_non_interactive_mode(t_mshell *mshell);
 
 // init minishell
 t_mshell		*init_mshell(char **envp);
-char			**setup_env(char **envp);
 char			**setup_builtin(void);
 char			*find_binary(t_cmd *cmd);
-char			*create_env_entry(t_mshell_var *var);
+char			*find_binary_cached(t_cmd *cmd);
+int				set_var_entry(t_mshell_var *var, const char *key,
+					const char *value);
 
 // setup hash table
-int				setup_hash_table(t_mshell *mshell);
-bool			add_env_entry(t_mshell_var *current,
-					char **new_env,
-					int *index);
-bool			process_env_bucket(t_mshell_var *bucket,
-					char **new_env,
-					int *index);
+int				setup_hash_table(t_mshell *mshell, char **env);
 int				set_variable(t_mshell *mshell,
 					char *key,
 					char *value,
@@ -139,10 +454,54 @@ void			update_existing_variable(t_mshell_var *current,
 					t_mshell_var *mshell_var,
 					int val_assigned,
 					t_mshell *mshell);
-unsigned int	hash_function(const char *key);
-int				update_env(t_mshell *mshell);
-char			*search_paths(char **paths, t_cmd *cmd);
-void			free_pair(t_mshell_var **pair);
+unsigned int	hash_function(const char *key, size_t *key_len);
+t_hash_tbl		*ht_create(size_t hint);
+size_t			ht_find_slot(t_hash_tbl *ht, const char *key,
+					unsigned int hash, size_t len);
+t_mshell_var	*ht_get(t_hash_tbl *ht, const char *key);
+int				ht_insert(t_hash_tbl *ht, t_mshell_var *var);
+t_mshell_var	*ht_remove(t_hash_tbl *ht, const char *key);
+t_mshell_var	*ht_iter_next(t_hash_tbl *ht, size_t *pos);
+int				ht_order_insert(t_hash_tbl *ht, t_mshell_var *var);
+void			ht_order_remove(t_hash_tbl *ht, t_mshell_var *var);
+int				ht_order_sort(t_hash_tbl *ht);
+int				var_name_cmp(const t_mshell_var *var, const char *key,
+					size_t len);
+int				init_env_slots(t_mshell *mshell, size_t cap);
+int				sync_env_slot(t_mshell *mshell, t_mshell_var *var);
+void			drop_env_slot(t_mshell *mshell, t_mshell_var *var);
+void			init_env_caches(t_mshell *mshell);
+void			mark_env_changed(t_mshell *mshell, t_mshell_var *var);
+unsigned long	ms_var_gen(t_mshell *mshell, const char *key);
+bool			var_cache_changed(t_mshell *mshell, t_var_cache *cache);
+char			*search_paths(t_path_cache *pc, t_cmd *cmd, size_t start);
+t_path_cache	*get_path_cache(t_mshell *mshell);
+void			close_path_dirs(t_path_cache *pc);
+int				path_dir_fd(t_path_dir *dir);
+void			path_dirs_stamp(t_path_cache *pc);
+bool			path_dirs_changed(t_path_cache *pc);
+bool			miss_cache_hit(t_path_cache *pc, const char *name);
+void			miss_cache_add(t_path_cache *pc, const char *name);
+void			miss_cache_clear(t_path_cache *pc);
+size_t			path_search_start(t_path_cache *pc, const char *name);
+bool			path_index_ready(t_path_cache *pc);
+int				path_index_build(t_path_cache *pc);
+int				path_index_add(t_path_index *idx, const char *name,
+					size_t len, size_t dir);
+t_pidx_slot		*path_index_get(t_path_index *idx, const char *name);
+void			path_index_reset(t_path_index *idx);
+void			path_index_free(t_path_index *idx);
+void			path_index_refresh(t_mshell *mshell);
+int				path_index_watch_init(t_path_index *idx);
+int				path_index_watch_dir(t_path_index *idx, const char *dir);
+bool			path_index_changed(t_path_index *idx);
+void			setup_completion(t_mshell *mshell);
+void			setup_job_control(t_mshell *mshell);
+t_cmd_entry		*cmd_table_get(t_cmd_tbl *ct, const char *name);
+int				cmd_table_insert(t_cmd_tbl *ct, const char *path);
+bool			cmd_table_remove(t_cmd_tbl *ct, const char *name);
+void			cmd_table_clear(t_cmd_tbl *ct);
+void			cmd_table_free(t_cmd_tbl *ct);
 t_mshell_var	*create_new_var(char *key, char *value, int assigned);
 int				update_existing_var(t_mshell_var *var, char
 					*value, int assigned);
@@ -154,7 +513,6 @@ int				set_variable(t_mshell *mshell, char *key,
 					char *value, int assigned);
 uint8_t			update_shlvl_setup_no_env(t_mshell *minishell);
 int				insert_env_var(t_mshell *mshell, char *entry);
-t_mshell_var	*allocate_env_var(void);
 
 // parser
 t_cmd			*run_parser(t_mshell *shell, char *input);
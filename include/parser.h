@@ -43,6 +43,7 @@ typedef struct s_parse_ctx
 	t_redir_ctx		redir;
 	int				i;
 }					t_parse_ctx;
+int					process_background_token(t_parse_ctx *ctx);
 bool				is_skippable_token(t_Token *tok);
 int					process_non_word(t_TokenArray *new_tokens, int *j,
 						t_Token *tok);
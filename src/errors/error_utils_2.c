@@ -26,13 +26,13 @@
  *
  * This function constructs and prints a message like:
  * `minishell: export: \`KEY=VALUE\`: not a valid identifier`
- * using the provided key-value pair. If `value` is NULL, only the key is shown.
+ * using the argument exactly as it was given to `export`.
  *
  * On write failure, a fallback message is printed instead.
  *
- * @param pair A `t_mshell_var` structure containing the invalid export variable.
+ * @param arg The invalid export argument.
  */
-void	export_error(t_mshell_var *pair)
+void	export_error(const char *arg)
 {
 	char				error_buf[ERROR_BUF_SIZE];
 	static const char	*fallback_msg;
@@ -40,13 +40,8 @@ void	export_error(t_mshell_var *pair)
 	fallback_msg = "minishell: error: failed to print error\n";
 	error_buf[0] = '\0';
 	ft_strlcpy(error_buf, "minishell: export: `", ERROR_BUF_SIZE);
-	if (pair->key)
-		ft_strlcat(error_buf, pair->key, ERROR_BUF_SIZE);
-	if (pair->value)
-	{
-		ft_strlcat(error_buf, "=", ERROR_BUF_SIZE);
-		ft_strlcat(error_buf, pair->value, ERROR_BUF_SIZE);
-	}
+	if (arg)
+		ft_strlcat(error_buf, arg, ERROR_BUF_SIZE);
 	ft_strlcat(error_buf, "': not a valid identifier\n", ERROR_BUF_SIZE);
 	if (write(STDERR_FILENO, error_buf, ft_strlen(error_buf)) < 0)
 		write(STDERR_FILENO, fallback_msg, ft_strlen(fallback_msg));
@@ -24,8 +24,7 @@
  * @brief Retrieves the value of an environment variable from the shell's
  * hash table.
  *
- * Computes the hash index for the given key and searches the corresponding
- * bucket's linked list for a matching key. If the key is found, its associated
+ * Looks the key up in the hash table. If the key is found, its associated
  * value is returned.
  *
  * @param mshell Pointer to the Minishell structure that contains the hash table.
@@ -37,21 +36,15 @@
  */
 char	*ms_getenv(t_mshell *mshell, char *key)
 {
-	unsigned int	index;
-	t_mshell_var	*curr;
+	t_mshell_var	*var;
 
 	if (!key || !mshell || !mshell->hash_table)
 	{
 		print_error("-minishell: ms_getenv: key/mshell/hash_table is NULL\n");
 		return (NULL);
 	}
-	index = hash_function(key);
-	curr = mshell->hash_table->buckets[index];
-	while (curr)
-	{
-		if (ft_strcmp(curr->key, key) == 0)
-			return (curr->value);
-		curr = curr->next;
-	}
-	return (NULL);
+	var = ht_get(mshell->hash_table, key);
+	if (!var)
+		return (NULL);
+	return (var->value);
 }
@@ -43,7 +43,6 @@ uint8_t	cd_too_many_args(void)
  * - Retrieves the new working directory.
  * - Sets `OLDPWD` to the previous directory.
  * - Sets `PWD` to the current directory.
- * - Triggers a rebuild of the exported environment with `update_env()`.
  *
  * @param cmd      Pointer to the current command structure.
  * @param old_cwd  The previous working directory before the `cd` call.
@@ -65,11 +64,6 @@ void	update_pwd_variables(t_cmd *cmd, char *old_cwd)
 		print_error("-minishell: update_pwd_variables, OLDPWD failed\n");
 		return ;
 	}
-	if (update_env(cmd->minishell) != EXIT_SUCCESS)
-	{
-		print_error("-minishell: update_pwd_variables, update_env failed\n");
-		return ;
-	}
 }
 
 /**
@@ -21,34 +21,6 @@
  */
 #include "minishell.h"
 
-/**
- * @brief Writes a string to standard output using `write()`.
- *
- * A wrapper around `write()` that prints the given string to STDOUT
- * (file descriptor 1).
- * If writing fails, an error message is printed, and failure is returned.
- *
- * @param str The null-terminated string to print.
- * @return `EXIT_SUCCESS` (0) on success, `EXIT_FAILURE` (1) on failure.
- */
-static int	ft_putstr_custom(t_cmd *cmd, char *str)
-{
-	ssize_t	written;
-	t_cmd	*head;
-
-	if (!str)
-		return (EXIT_FAILURE);
-	head = get_cmd_head(cmd);
-	written = write(STDOUT_FILENO, str, ft_strlen(str));
-	if (written == -1 && errno == EPIPE)
-	{
-		free_minishell(&cmd->minishell);
-		free_cmd(&head);
-		return (perror_return("ft_putstr_custom: write", EXIT_FAILURE));
-	}
-	return (EXIT_SUCCESS);
-}
-
 /**
  * @brief Prints the actual content (arguments) of the `echo` command.
  *
@@ -56,30 +28,33 @@ static int	ft_putstr_custom(t_cmd *cmd, char *str)
  * a space.
  * If the `-n` flag was not set, a newline is printed at the end.
  * If no arguments are present after the command, a newline is printed by
- * default.
+ * default. The output is collected in a `t_wbuf` and written at once.
  *
  * @param cmd Pointer to the current command structure.
  * @param i Index in `cmd->argv[]` to start printing from.
  * @param newline_flag Pointer to an int indicating whether to print
  * a newline (1 = yes).
- * @return `EXIT_SUCCESS` on successful printing, `EXIT_FAILURE` on write error.
+ * @return `EXIT_SUCCESS` on successful printing, or the status of
+ * `wbuf_error()` on write error.
  */
 static uint8_t	print_content(t_cmd *cmd, int i, int *newline_flag)
 {
+	t_wbuf	wb;
+
+	wbuf_init(&wb, STDOUT_FILENO);
 	if (!cmd->argv[1])
-		return (ft_putstr_custom(cmd, "\n"));
-	while (cmd->argv[i])
+		wbuf_puts(&wb, "\n");
+	while (cmd->argv[1] && cmd->argv[i])
 	{
-		if (!cmd->argv[i])
-			return (error_return("print_content: failed\n", EXIT_FAILURE));
-		if (ft_putstr_custom(cmd, cmd->argv[i]) == EXIT_FAILURE)
-			return (EXIT_FAILURE);
-		if (cmd->argv[i + 1] && ft_putstr_custom(cmd, " ") == EXIT_FAILURE)
-			return (EXIT_FAILURE);
+		wbuf_puts(&wb, cmd->argv[i]);
+		if (cmd->argv[i + 1])
+			wbuf_puts(&wb, " ");
 		i++;
 	}
-	if (*newline_flag && ft_putstr_custom(cmd, "\n") == EXIT_FAILURE)
-		return (EXIT_FAILURE);
+	if (cmd->argv[1] && *newline_flag)
+		wbuf_puts(&wb, "\n");
+	if (wbuf_flush(&wb) != EXIT_SUCCESS)
+		return (wbuf_error("echo: write error"));
 	return (EXIT_SUCCESS);
 }
 
@@ -26,20 +26,28 @@
  * Iterates through the shell's internal environment array and prints each
  * variable to standard output. Only variables that are actually present in
  * the internal `env` list are printed—unset or hidden variables are not shown.
+ * The lines go through one `t_wbuf`.
  *
  * @param cmd Pointer to the command structure, which contains
  * the shell environment.
+ * @return `EXIT_SUCCESS`, or the status of `wbuf_error()` if writing fails.
  */
-void	print_env(t_cmd *cmd)
+uint8_t	print_env(t_cmd *cmd)
 {
-	int	i;
+	t_wbuf	wb;
+	int		i;
 
+	wbuf_init(&wb, STDOUT_FILENO);
 	i = 0;
 	while (cmd->minishell->env[i])
 	{
-		(void)printf("%s\n", cmd->minishell->env[i]);
+		wbuf_puts(&wb, cmd->minishell->env[i]);
+		wbuf_puts(&wb, "\n");
 		i++;
 	}
+	if (wbuf_flush(&wb) != EXIT_SUCCESS)
+		return (wbuf_error("env: write error"));
+	return (EXIT_SUCCESS);
 }
 
 /**
@@ -56,7 +64,8 @@ void	print_env(t_cmd *cmd)
  * @param cmd Pointer to the command structure containing the shell state
  * and arguments.
  * @return `EXIT_SUCCESS` (0) on success,
- *         `127` if called with arguments (invalid usage).
+ *         `127` if called with arguments (invalid usage),
+ *         or the status of `wbuf_error()` if writing fails.
  */
 uint8_t	handle_env(t_cmd *cmd)
 {
@@ -72,7 +81,6 @@ uint8_t	handle_env(t_cmd *cmd)
 		exit_status = 127;
 		return (exit_status);
 	}
-	print_env(cmd);
-	exit_status = EXIT_SUCCESS;
+	exit_status = print_env(cmd);
 	return (exit_status);
 }
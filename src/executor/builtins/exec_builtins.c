@@ -62,13 +62,19 @@ bool	is_builtin(t_cmd *cmd)
 const t_builtin_disp	*get_builtin_table(size_t *size)
 {
 	static const t_builtin_disp	table[] = {
+	{"bg", &handle_bg},
 	{"cd", &handle_cd},
 	{"echo", &handle_echo},
 	{"env", &handle_env},
 	{"exit", &handle_exit},
 	{"export", &handle_export},
+	{"fg", &handle_fg},
+	{"hash", &handle_hash},
+	{"jobs", &handle_jobs},
 	{"pwd", &handle_pwd},
+	{"set", &handle_set},
 	{"unset", &handle_unset},
+	{"wait", &handle_wait},
 	};
 
 	if (size)
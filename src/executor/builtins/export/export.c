@@ -16,51 +16,17 @@
  *
  * This file defines the logic for handling the `export` command, which allows
  * users to create, update, or list environment variables. The implementation
- * validates variable names, parses key-value pairs, and supports
+ * validates variable names, stores key-value pairs, and supports
  * Bash-compatible behavior, including error handling and formatted output.
  */
 #include "minishell.h"
 
-/**
- * @brief Validates and prepares a variable pair for export.
- *
- * Verifies the input and splits it into key-value. Also validates
- * that the key conforms to shell naming rules.
- *
- * @param arg The export argument string.
- * @return Pointer to t_mshell_var on success, NULL on error.
- */
-static t_mshell_var	*validate_export_pair(char *arg)
-{
-	t_mshell_var	*pair;
-
-	if (!arg)
-	{
-		print_error("-minishell: process_export_arg: no arg");
-		return (NULL);
-	}
-	pair = split_key_value(arg);
-	if (!pair)
-	{
-		print_error("-minishell: export: memory allocation failed\n");
-		return (NULL);
-	}
-	if (!is_valid_varname(pair->key))
-	{
-		export_error(pair);
-		free(pair->key);
-		free(pair->value);
-		free(pair);
-		return (NULL);
-	}
-	return (pair);
-}
-
 /**
  * @brief Processes a single argument for the `export` command.
  *
- * Sets the validated variable in the shell environment, determining
- * whether it is assigned or declared. Handles memory cleanup.
+ * Validates the name, then sets the variable in the shell environment,
+ * determining whether it is assigned or declared. The argument is passed
+ * as is: the name ends at the first `=`, and the value follows it.
  *
  * @param cmd Pointer to the command structure.
  * @param arg Argument string containing the variable.
@@ -68,24 +34,24 @@ static t_mshell_var	*validate_export_pair(char *arg)
  */
 static uint8_t	process_export_arg(t_cmd *cmd, char *arg)
 {
-	t_mshell_var	*pair;
-	int				assigned;
+	char	*value;
 
-	pair = validate_export_pair(arg);
-	if (!pair)
+	if (!arg)
+	{
+		print_error("-minishell: process_export_arg: no arg");
 		return (EXIT_FAILURE);
-	assigned = (ft_strchr(arg, '=') != NULL);
-	if (set_variable(cmd->minishell, pair->key,
-			pair->value, assigned) != EXIT_SUCCESS)
+	}
+	if (!is_valid_varname(arg))
 	{
-		free(pair->key);
-		free(pair->value);
-		free(pair);
-		return (error_return("export: set_variable failed", EXIT_FAILURE));
+		export_error(arg);
+		return (EXIT_FAILURE);
 	}
-	free(pair->key);
-	free(pair->value);
-	free(pair);
+	value = ft_strchr(arg, '=');
+	if (value)
+		value++;
+	if (set_variable(cmd->minishell, arg, value,
+			value != NULL) != EXIT_SUCCESS)
+		return (error_return("export: set_variable failed", EXIT_FAILURE));
 	return (EXIT_SUCCESS);
 }
 
@@ -161,7 +127,5 @@ uint8_t	handle_export(t_cmd *cmd)
 		exit_status = process_export_arg(cmd, cmd->argv[i]);
 		i++;
 	}
-	if (update_env(cmd->minishell) != EXIT_SUCCESS)
-		perror_return("handle_export, update_env failed\n", EXIT_FAILURE);
 	return (exit_status);
 }
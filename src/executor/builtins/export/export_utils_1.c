@@ -11,149 +11,73 @@
 /* ************************************************************************** */
 
 /**
- * @file export_utils_1.c.c
- * @brief Sorting and printing logic for the `export` built-in in Minishell.
+ * @file export_utils_1.c
+ * @brief Sorted printing logic for the `export` built-in in Minishell.
  *
- * This file implements logic to collect, sort, and print the environment
- * variables in a format compatible with the Bash `export` command.
- * Variables are printed in lexicographically sorted order as:
+ * This file prints the environment variables in a format compatible with
+ * the Bash `export` command. Variables are printed in lexicographically
+ * sorted order as:
  *
  * - `declare -x VAR="value"` if a value is present.
  * - `declare -x VAR` if no value is set.
  *
- * The sorting is done using a simple bubble sort algorithm for simplicity.
+ * The hash table keeps its variables ordered by name (`ht->order`), so
+ * nothing is copied or sorted here; the lines go through one `t_wbuf`.
  */
 #include "minishell.h"
 
 /**
- * @brief Frees an array of dynamically allocated strings.
+ * @brief Appends one variable in `declare -x` format to the buffer.
  *
- * Used to deallocate the memory allocated for environment variable keys
- * after printing.
- *
- * @param keys Array of strings to free.
- * @param num_kyes Number of elements in the `keys` array.
+ * @param wb Output buffer.
+ * @param var Variable to print.
  */
-void	free_keys(char ***keys_ptr, int num_keys)
+static void	print_export_line(t_wbuf *wb, t_mshell_var *var)
 {
-	char	**keys;
-	int		i;
-
-	if (!keys_ptr || !*keys_ptr)
-		return ;
-	keys = *keys_ptr;
-	i = 0;
-	while (i < num_keys)
+	wbuf_puts(wb, "declare -x ");
+	wbuf_write(wb, var->key, var->key_len);
+	if (var->value)
 	{
-		if (keys[i])
-		{
-			free(keys[i]);
-			keys[i] = NULL;
-		}
-		i++;
+		wbuf_puts(wb, "=\"");
+		wbuf_puts(wb, var->value);
+		wbuf_puts(wb, "\"");
 	}
-	free(keys);
-	*keys_ptr = NULL;
+	wbuf_puts(wb, "\n");
 }
 
 /**
- * @brief Sorts an array of strings alphabetically using bubble sort.
+ * @brief Prints environment variables in export format, sorted by name.
  *
- * This function performs an in-place sort of the provided array using
- * the bubble sort algorithm and `ft_strcmp()` for comparison.
+ * Handles the logic for `export` with no arguments: walks the ordered
+ * index of the hash table and prints each key and its value in Bash-like
+ * format. The `_` variable is skipped to mimic Bash behavior.
  *
- * @param keys Array of environment variable keys.
- * @param count Number of elements in the array.
- */
-static void	bubble_sort(char **keys, int count)
-{
-	int		i;
-	int		j;
-	char	*temp;
-
-	i = 0;
-	while (i < count - 1)
-	{
-		j = 0;
-		while (j < (count - i - 1))
-		{
-			if (ft_strcmp(keys[j], keys[j + 1]) > 0)
-			{
-				temp = keys[j];
-				keys[j] = keys[j + 1];
-				keys[j + 1] = temp;
-			}
-			j++;
-		}
-		i++;
-	}
-}
-
-/**
- * @brief Prints sorted environment variables in `declare -x` format.
- *
- * This function formats and prints each key-value pair:
- * - If a value is assigned: `declare -x key="value"`
- * - If no value is assigned: `declare -x key`
- *
- * The `_` variable is skipped from printing to mimic Bash behavior.
- *
- * @param mshell Pointer to the Minishell structure.
- * @param keys Array of sorted environment variable keys.
- * @param count Number of keys in the array.
- */
-static void	print_sorted_env(t_mshell *mshell, char **keys, int count)
-{
-	int		i;
-	char	*value;
-
-	i = 0;
-	while (i < count)
-	{
-		value = ms_getenv(mshell, keys[i]);
-		if (ft_strcmp(keys[i], "_") != 0)
-		{
-			if (value)
-				(void)printf("declare -x %s=\"%s\"\n", keys[i], value);
-			else
-				(void)printf("declare -x %s\n", keys[i]);
-		}
-		i++;
-	}
-}
-
-/**
- * @brief Collects, sorts, and prints environment variables in export format.
- *
- * Handles the logic for `export` with no arguments:
- * - Gathers all environment keys from the hash table.
- * - Sorts them alphabetically.
- * - Prints each key and its value in Bash-like format.
- * - Frees any temporary memory allocated during the process.
- *
- * Prints errors if the shell context or hash table is invalid.
+ * Prints errors if the shell context or hash table is invalid, or if
+ * the output cannot be written.
  *
  * @param mshell Pointer to the Minishell shell state structure.
  */
 int	handle_sorted_env(t_mshell *mshell)
 {
-	char		**keys;
-	int			count;
+	t_hash_tbl	*ht;
+	t_wbuf		wb;
+	size_t		i;
 
 	if (!mshell || !mshell->hash_table)
 	{
 		print_error("-minishell: export: no mshell or hash_table found\n");
 		return (EXIT_FAILURE);
 	}
-	if (collect_keys(mshell->hash_table, &keys, &count) != EXIT_SUCCESS)
-		return (EXIT_FAILURE);
-	if (!keys)
+	ht = mshell->hash_table;
+	wbuf_init(&wb, STDOUT_FILENO);
+	i = 0;
+	while (i < ht->count)
 	{
-		print_error("-minishell: export: keys memory allocation failed\n");
-		return (EXIT_FAILURE);
+		if (ht->order[i]->key_len != 1 || ht->order[i]->key[0] != '_')
+			print_export_line(&wb, ht->order[i]);
+		i++;
 	}
-	bubble_sort(keys, count);
-	print_sorted_env(mshell, keys, count);
-	free_keys(&keys, count);
+	if (wbuf_flush(&wb) != EXIT_SUCCESS)
+		return (wbuf_error("export: write error"));
 	return (EXIT_SUCCESS);
 }
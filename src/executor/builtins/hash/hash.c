@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file hash.c
+ * @brief Implementation of the `hash` built-in command for Minishell.
+ *
+ * `hash` shows or edits the command table, the names the shell already
+ * found through `PATH`:
+ *
+ * - `hash`:			list remembered commands with their hit counts, then
+ *					the table-wide hit and miss counters.
+ * - `hash -l`:		list them in a form that can be reused as input.
+ * - `hash -r`:		forget every remembered command.
+ * - `hash -d name`:	forget the given names.
+ * - `hash name`:		search `PATH` for the given names and remember them.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Reports a name that `hash` could not find or forget.
+ *
+ * @param name The name.
+ * @return Always `EXIT_FAILURE`.
+ */
+static uint8_t	hash_not_found(const char *name)
+{
+	char	error_buf[ERROR_BUF_SIZE];
+
+	ft_strlcpy(error_buf, "hash: ", ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, name, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, ": not found\n", ERROR_BUF_SIZE);
+	error_return(error_buf, 0);
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Forgets each name of `hash -d name...`.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param names NULL-terminated list of names.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if a name was not remembered.
+ */
+static uint8_t	forget_commands(t_mshell *mshell, char **names)
+{
+	uint8_t	exit_status;
+
+	exit_status = EXIT_SUCCESS;
+	while (*names)
+	{
+		if (!cmd_table_remove(&mshell->cmd_table, *names))
+			exit_status = hash_not_found(*names);
+		names++;
+	}
+	return (exit_status);
+}
+
+/**
+ * @brief Searches `PATH` for each name of `hash name...`.
+ *
+ * As in bash, a remembered name is searched again and its hit count
+ * starts over at 0; names containing a `/` and builtins are skipped. A name
+ * found in a `PATH` directory is remembered by `find_binary()`.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param names NULL-terminated list of names.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if a name was not found.
+ */
+static uint8_t	remember_commands(t_mshell *mshell, char **names)
+{
+	t_cmd		lookup;
+	t_cmd_entry	*entry;
+	char		*binary;
+	uint8_t		exit_status;
+
+	exit_status = EXIT_SUCCESS;
+	ft_bzero(&lookup, sizeof(lookup));
+	lookup.minishell = mshell;
+	while (*names)
+	{
+		lookup.argv = names;
+		if (!ft_strchr(*names, '/') && !is_builtin(&lookup))
+		{
+			cmd_table_remove(&mshell->cmd_table, *names);
+			binary = find_binary(&lookup);
+			if (!binary)
+				exit_status = hash_not_found(*names);
+			free(binary);
+			entry = cmd_table_get(&mshell->cmd_table, *names);
+			if (entry)
+				entry->hits = 0;
+		}
+		names++;
+	}
+	return (exit_status);
+}
+
+/**
+ * @brief Reports an unsupported `hash` invocation.
+ *
+ * @param arg The offending argument.
+ * @return Always `2`, the status for invalid usage.
+ */
+static uint8_t	hash_usage(const char *arg)
+{
+	char	error_buf[ERROR_BUF_SIZE];
+
+	ft_strlcpy(error_buf, "hash: ", ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, arg, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, ": invalid option\n", ERROR_BUF_SIZE);
+	error_return(error_buf, 0);
+	print_error("hash: usage: hash [-lr] [-d] [name ...]\n");
+	return (2);
+}
+
+/**
+ * @brief Entry point for the `hash` built-in.
+ *
+ * The `PATH` cache is revalidated first, so a table made stale by a
+ * `PATH` change is already empty.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return Exit status of the requested operation.
+ */
+uint8_t	handle_hash(t_cmd *cmd)
+{
+	t_mshell	*mshell;
+	char		**argv;
+
+	mshell = cmd->minishell;
+	argv = cmd->argv;
+	get_path_cache(mshell);
+	if (!argv[1] || ft_strcmp(argv[1], "-l") == 0)
+		return (print_cmd_table(mshell, argv[1] != NULL));
+	if (ft_strcmp(argv[1], "-r") == 0 && !argv[2])
+	{
+		cmd_table_clear(&mshell->cmd_table);
+		return (EXIT_SUCCESS);
+	}
+	if (ft_strcmp(argv[1], "-d") == 0 && argv[2])
+		return (forget_commands(mshell, argv + 2));
+	if (ft_strcmp(argv[1], "--") == 0)
+		return (remember_commands(mshell, argv + 2));
+	if (argv[1][0] != '-' || !argv[1][1])
+		return (remember_commands(mshell, argv + 1));
+	return (hash_usage(argv[1]));
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file hash_utils.c
+ * @brief Printing of the command table for the `hash` built-in.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Appends a number right-aligned to `width` columns, then `end`.
+ *
+ * @param wb Output buffer.
+ * @param n Number to print.
+ * @param width Minimum number of columns before `end`.
+ * @param end Character to append after the number.
+ */
+static void	put_number(t_wbuf *wb, unsigned long n, size_t width, char end)
+{
+	char	digits[24];
+	size_t	start;
+
+	start = sizeof(digits) - 1;
+	digits[start] = end;
+	while (start == sizeof(digits) - 1 || n)
+	{
+		digits[--start] = '0' + n % 10;
+		n /= 10;
+	}
+	while (sizeof(digits) - start < width + 1)
+		digits[--start] = ' ';
+	wbuf_write(wb, digits + start, sizeof(digits) - start);
+}
+
+/**
+ * @brief Appends one remembered command.
+ *
+ * @param wb Output buffer.
+ * @param entry Command table entry.
+ * @param reusable `true` for `builtin hash -p path name` lines,
+ *                 `false` for `hits<TAB>path` lines.
+ */
+static void	print_cmd_entry(t_wbuf *wb, t_cmd_entry *entry, bool reusable)
+{
+	if (reusable)
+	{
+		wbuf_puts(wb, "builtin hash -p ");
+		wbuf_puts(wb, entry->path);
+		wbuf_write(wb, " ", 1);
+		wbuf_puts(wb, entry->name);
+	}
+	else
+	{
+		put_number(wb, entry->hits, 4, '\t');
+		wbuf_puts(wb, entry->path);
+	}
+	wbuf_write(wb, "\n", 1);
+}
+
+/**
+ * @brief Appends the table-wide counters.
+ *
+ * @param wb Output buffer.
+ * @param ct Command table.
+ */
+static void	print_cmd_counters(t_wbuf *wb, t_cmd_tbl *ct)
+{
+	wbuf_puts(wb, "hash: ");
+	put_number(wb, ct->hits, 0, ' ');
+	wbuf_puts(wb, "hits, ");
+	put_number(wb, ct->misses, 0, ' ');
+	wbuf_puts(wb, "misses\n");
+}
+
+/**
+ * @brief Prints the command table.
+ *
+ * The plain listing ends with the number of lookups answered from the
+ * table and of those that had to search `PATH`. `hash -l` leaves them
+ * out, so that its output stays valid input.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param reusable `true` for `hash -l` output.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if writing fails.
+ */
+uint8_t	print_cmd_table(t_mshell *mshell, bool reusable)
+{
+	t_cmd_tbl	*ct;
+	t_wbuf		wb;
+	size_t		i;
+
+	ct = &mshell->cmd_table;
+	wbuf_init(&wb, STDOUT_FILENO);
+	if (ct->count == 0)
+		wbuf_puts(&wb, "hash: hash table empty\n");
+	else if (!reusable)
+		wbuf_puts(&wb, "hits\tcommand\n");
+	i = 0;
+	while (i < ct->cap)
+	{
+		if (ct->slots[i].path)
+			print_cmd_entry(&wb, &ct->slots[i], reusable);
+		i++;
+	}
+	if (!reusable)
+		print_cmd_counters(&wb, ct);
+	if (wbuf_flush(&wb) != EXIT_SUCCESS)
+		return (wbuf_error("hash: write error"));
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fg_bg.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file fg_bg.c
+ * @brief Implementation of the `fg` and `bg` built-in commands.
+ *
+ * - `fg [job]`:	continue a job in the foreground and wait for it.
+ * - `bg [job]`:	continue a stopped job in the background.
+ *
+ * Both need job control, so they only work when the shell runs on a
+ * terminal. Without an argument they act on the current job.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Looks up the job `fg` or `bg` acts on.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return The job, or NULL after printing an error.
+ */
+static t_job	*get_job(t_cmd *cmd)
+{
+	if (!cmd->minishell->job_control)
+	{
+		if (ft_strcmp(cmd->argv[0], "fg") == 0)
+			print_error("minishell: fg: no job control\n");
+		else
+			print_error("minishell: bg: no job control\n");
+		return (NULL);
+	}
+	return (job_from_spec(cmd->minishell, cmd->argv[1], cmd->argv[0]));
+}
+
+/**
+ * @brief Prints a line about a job, e.g. `[1]+ sleep 10 &`.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param job Job to print.
+ * @param suffix Text after the command.
+ */
+static void	print_job_line(t_mshell *mshell, t_job *job, const char *suffix)
+{
+	t_wbuf	wb;
+	char	*num;
+
+	wbuf_init(&wb, STDOUT_FILENO);
+	num = ft_itoa(job->id);
+	wbuf_puts(&wb, "[");
+	if (num)
+		wbuf_puts(&wb, num);
+	free(num);
+	wbuf_puts(&wb, "]");
+	wbuf_puts(&wb, job_mark(mshell, job));
+	wbuf_puts(&wb, " ");
+	wbuf_puts(&wb, job->cmdline);
+	wbuf_puts(&wb, suffix);
+	wbuf_flush(&wb);
+}
+
+/**
+ * @brief Records how a job brought to the foreground ended.
+ *
+ * A job that stopped again stays in the table and is reported; a
+ * finished one sets `PIPESTATUS` and leaves the table. As for other
+ * foreground commands, a newline follows an interrupt.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param job The job.
+ * @param status Status returned by `wait_for_job()`.
+ * @return `status`.
+ */
+static uint8_t	end_foreground_job(t_mshell *mshell, t_job *job,
+	uint8_t status)
+{
+	t_wbuf	wb;
+
+	if (job->state == JOB_STOPPED)
+	{
+		wbuf_init(&wb, STDERR_FILENO);
+		wbuf_puts(&wb, "\n");
+		put_job(&wb, mshell, job);
+		wbuf_flush(&wb);
+		job->changed = false;
+		set_pipestatus(mshell, &status, 1);
+		return (status);
+	}
+	if (status == 128 + SIGINT && isatty(STDOUT_FILENO))
+		write(STDOUT_FILENO, "\n", 1);
+	set_pipestatus(mshell, job->statuses, job->count);
+	job_remove(mshell, job);
+	return (status);
+}
+
+/**
+ * @brief Entry point for the `fg` built-in.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return Exit status of the job, or `EXIT_FAILURE` if there is none.
+ */
+uint8_t	handle_fg(t_cmd *cmd)
+{
+	t_mshell	*mshell;
+	t_job		*job;
+	uint8_t		status;
+
+	mshell = cmd->minishell;
+	job = get_job(cmd);
+	if (!job)
+		return (EXIT_FAILURE);
+	ft_putendl_fd(job->cmdline, STDOUT_FILENO);
+	give_terminal(mshell, job->pgid);
+	if (job->state == JOB_STOPPED)
+		kill(-job->pgid, SIGCONT);
+	job->state = JOB_RUNNING;
+	status = wait_for_job(mshell, job);
+	give_terminal(mshell, mshell->shell_pgid);
+	return (end_foreground_job(mshell, job, status));
+}
+
+/**
+ * @brief Entry point for the `bg` built-in.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if there is no such job.
+ */
+uint8_t	handle_bg(t_cmd *cmd)
+{
+	t_job	*job;
+	char	error_buf[ERROR_BUF_SIZE];
+	char	*num;
+
+	job = get_job(cmd);
+	if (!job)
+		return (EXIT_FAILURE);
+	if (job->state == JOB_RUNNING)
+	{
+		num = ft_itoa(job->id);
+		ft_strlcpy(error_buf, "bg: job ", ERROR_BUF_SIZE);
+		if (num)
+			ft_strlcat(error_buf, num, ERROR_BUF_SIZE);
+		free(num);
+		ft_strlcat(error_buf, " already in background\n", ERROR_BUF_SIZE);
+		return (error_return(error_buf, EXIT_SUCCESS));
+	}
+	kill(-job->pgid, SIGCONT);
+	job->state = JOB_RUNNING;
+	print_job_line(cmd->minishell, job, " &\n");
+	return (EXIT_SUCCESS);
+}
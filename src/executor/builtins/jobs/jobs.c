@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jobs.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file jobs.c
+ * @brief Implementation of the `jobs` built-in command for Minishell.
+ *
+ * - `jobs`:		list the jobs with their state and command.
+ * - `jobs -p`:	list the process group (or process ID) of each job.
+ *
+ * Jobs reported as done are removed from the table.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Reports an unsupported `jobs` option.
+ *
+ * @param arg The offending argument.
+ * @return Always `2`, the status for invalid usage.
+ */
+static uint8_t	jobs_usage(const char *arg)
+{
+	char	error_buf[ERROR_BUF_SIZE];
+
+	ft_strlcpy(error_buf, "jobs: ", ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, arg, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, ": invalid option\n", ERROR_BUF_SIZE);
+	error_return(error_buf, 0);
+	print_error("jobs: usage: jobs [-p]\n");
+	return (2);
+}
+
+/**
+ * @brief Appends the process group of a job, or without job control
+ * the process ID of its first stage.
+ *
+ * @param wb Output buffer.
+ * @param job Job to report.
+ */
+static void	put_job_pid(t_wbuf *wb, t_job *job)
+{
+	pid_t	pid;
+	char	*num;
+
+	pid = job->pgid;
+	if (pid == 0)
+		pid = job->pids[0];
+	if (pid < 0)
+		pid = -pid;
+	num = ft_itoa(pid);
+	if (num)
+		wbuf_puts(wb, num);
+	free(num);
+	wbuf_puts(wb, "\n");
+}
+
+/**
+ * @brief Entry point for the `jobs` built-in.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return `EXIT_SUCCESS`, `EXIT_FAILURE` if writing fails, or `2` for
+ *         an invalid option.
+ */
+uint8_t	handle_jobs(t_cmd *cmd)
+{
+	t_mshell	*mshell;
+	t_wbuf		wb;
+	size_t		i;
+
+	mshell = cmd->minishell;
+	if (cmd->argv[1] && (ft_strcmp(cmd->argv[1], "-p") != 0 || cmd->argv[2]))
+		return (jobs_usage(cmd->argv[1]));
+	poll_jobs(mshell);
+	wbuf_init(&wb, STDOUT_FILENO);
+	i = 0;
+	while (i < mshell->jobs.count)
+	{
+		if (cmd->argv[1])
+			put_job_pid(&wb, &mshell->jobs.jobs[i]);
+		else
+			put_job(&wb, mshell, &mshell->jobs.jobs[i]);
+		mshell->jobs.jobs[i].changed = false;
+		if (mshell->jobs.jobs[i].state == JOB_DONE)
+			job_remove(mshell, &mshell->jobs.jobs[i]);
+		else
+			i++;
+	}
+	if (wbuf_flush(&wb) != EXIT_SUCCESS)
+		return (wbuf_error("jobs: write error"));
+	return (EXIT_SUCCESS);
+}
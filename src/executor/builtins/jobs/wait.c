@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file wait.c
+ * @brief Implementation of the `wait` built-in command for Minishell.
+ *
+ * - `wait`:			wait for every running job; returns 0.
+ * - `wait %N`:		wait for a job; returns its status.
+ * - `wait PID`:		wait for one process of a job; returns its status.
+ *
+ * Ctrl-C interrupts the wait, which then returns 130.
+ */
+#include "minishell.h"
+
+/**
+ * @brief SIGINT handler used while `wait` blocks.
+ *
+ * Installed without SA_RESTART, so the pending `waitpid()` fails with
+ * EINTR.
+ */
+static void	wait_sigint(int sig)
+{
+	(void)sig;
+	g_signal_flag = 1;
+}
+
+/**
+ * @brief Reports an argument `wait` cannot wait for.
+ *
+ * @param pre Text before the argument.
+ * @param arg The argument.
+ * @param post Text after the argument.
+ * @param status Status to return.
+ * @return `status`.
+ */
+static uint8_t	wait_error(const char *pre, const char *arg, const char *post,
+	uint8_t status)
+{
+	char	error_buf[ERROR_BUF_SIZE];
+
+	ft_strlcpy(error_buf, "wait: ", ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, pre, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, arg, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, post, ERROR_BUF_SIZE);
+	return (error_return(error_buf, status));
+}
+
+/**
+ * @brief Waits for one process of a job.
+ *
+ * A process already reaped gives the status it ended with.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param arg The process ID, as text.
+ * @return Exit status of the process, `127` if it is not a job of this
+ *         shell, or `130` if interrupted.
+ */
+static uint8_t	wait_pid(t_mshell *mshell, const char *arg)
+{
+	t_job	*job;
+	size_t	stage;
+	pid_t	pid;
+	int		status;
+
+	pid = ft_atoi(arg);
+	job = job_find_pid(&mshell->jobs, pid, &stage);
+	if (!job)
+		job = job_find_pid(&mshell->jobs, -pid, &stage);
+	if (!job)
+		return (wait_error("pid ", arg, " is not a child of this shell\n",
+				127));
+	while (job->pids[stage] == pid && waitpid(pid, &status, 0) == pid)
+		job_note_status(mshell, pid, status);
+	if (job->pids[stage] == pid && errno == EINTR)
+		return (128 + SIGINT);
+	status = job->statuses[stage];
+	if (job->state == JOB_DONE)
+		job_remove(mshell, job);
+	return (status);
+}
+
+/**
+ * @brief Waits for the job or process named by one argument.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param arg A job specification or a process ID.
+ * @return Exit status of what was waited for.
+ */
+static uint8_t	wait_arg(t_mshell *mshell, const char *arg)
+{
+	t_job	*job;
+	uint8_t	status;
+
+	if (arg[0] != '%')
+	{
+		if (!ft_isdigit(arg[0]) || !is_valid_numeric_exit_arg(arg))
+			return (wait_error("`", arg, "': not a pid or valid job spec\n",
+					2));
+		return (wait_pid(mshell, arg));
+	}
+	job = job_from_spec(mshell, arg, "wait");
+	if (!job)
+		return (127);
+	status = wait_for_job(mshell, job);
+	if (job->state == JOB_DONE)
+		job_remove(mshell, job);
+	return (status);
+}
+
+/**
+ * @brief Entry point for the `wait` built-in.
+ *
+ * With several arguments each one is waited for in turn and the status
+ * of the last one is returned.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return Exit status as described in the file comment.
+ */
+uint8_t	handle_wait(t_cmd *cmd)
+{
+	struct sigaction	sa;
+	struct sigaction	sa_original;
+	uint8_t				status;
+	int					i;
+
+	sa.sa_handler = wait_sigint;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_flags = 0;
+	sigaction(SIGINT, &sa, &sa_original);
+	status = EXIT_SUCCESS;
+	if (!cmd->argv[1])
+		status = wait_all_jobs(cmd->minishell);
+	i = 1;
+	while (cmd->argv[i] && !g_signal_flag)
+		status = wait_arg(cmd->minishell, cmd->argv[i++]);
+	sigaction(SIGINT, &sa_original, NULL);
+	if (!g_signal_flag)
+		return (status);
+	g_signal_flag = 0;
+	return (128 + SIGINT);
+}
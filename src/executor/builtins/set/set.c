@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   set.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file set.c
+ * @brief Implementation of the `set` built-in command for Minishell.
+ *
+ * Only shell options are supported:
+ *
+ * - `set -o`:				list the options and whether they are on.
+ * - `set +o`:				list them as commands that restore them.
+ * - `set -o pipefail`:	a pipeline returns its last failing status.
+ * - `set +o pipefail`:	a pipeline returns its last stage's status.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Reports an unsupported `set` invocation.
+ *
+ * @param arg The offending argument.
+ * @param what Description of the error, e.g. `invalid option`.
+ * @return Always `2`, the status for invalid usage.
+ */
+static uint8_t	set_usage(const char *arg, const char *what)
+{
+	char	error_buf[ERROR_BUF_SIZE];
+
+	ft_strlcpy(error_buf, "set: ", ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, arg, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, ": ", ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, what, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, "\n", ERROR_BUF_SIZE);
+	error_return(error_buf, 0);
+	print_error("set: usage: set [-o|+o] [pipefail]\n");
+	return (2);
+}
+
+/**
+ * @brief Prints the shell options.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param reusable `true` for `set +o` output.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if writing fails.
+ */
+static uint8_t	print_options(t_mshell *mshell, bool reusable)
+{
+	t_wbuf	wb;
+
+	wbuf_init(&wb, STDOUT_FILENO);
+	if (reusable && mshell->pipefail)
+		wbuf_puts(&wb, "set -o pipefail\n");
+	else if (reusable)
+		wbuf_puts(&wb, "set +o pipefail\n");
+	else if (mshell->pipefail)
+		wbuf_puts(&wb, "pipefail       \ton\n");
+	else
+		wbuf_puts(&wb, "pipefail       \toff\n");
+	if (wbuf_flush(&wb) != EXIT_SUCCESS)
+		return (wbuf_error("set: write error"));
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Entry point for the `set` built-in.
+ *
+ * Without arguments the options are listed, as with `set -o`.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return Exit status of the requested operation.
+ */
+uint8_t	handle_set(t_cmd *cmd)
+{
+	char	**argv;
+
+	argv = cmd->argv;
+	if (!argv[1])
+		return (print_options(cmd->minishell, false));
+	if (ft_strcmp(argv[1], "-o") != 0 && ft_strcmp(argv[1], "+o") != 0)
+		return (set_usage(argv[1], "invalid option"));
+	if (!argv[2])
+		return (print_options(cmd->minishell, argv[1][0] == '+'));
+	if (ft_strcmp(argv[2], "pipefail") != 0 || argv[3])
+		return (set_usage(argv[2], "invalid option name"));
+	cmd->minishell->pipefail = (argv[1][0] == '-');
+	return (EXIT_SUCCESS);
+}
@@ -65,9 +65,10 @@ static bool	is_valid_identifier(const char *name)
 /**
  * @brief Removes a variable from the shell's environment hash table.
  *
- * Looks for a variable with the specified `key` in the hash table and unlinks
- * it from the corresponding bucket. After successful removal, it updates the
- * exported environment (`mshell->env`) via `update_env()`.
+ * Looks for a variable with the specified `key` in the hash table and
+ * removes it from the table. Its slot in the exported environment
+ * (`mshell->env`) is released via `drop_env_slot()`, and the environment
+ * generation is bumped.
  *
  * @param mshell Pointer to the shell instance.
  * @param key The name of the environment variable to remove.
@@ -75,30 +76,16 @@ static bool	is_valid_identifier(const char *name)
  */
 static uint8_t	remove_var_from_ht(t_mshell *mshell, char *key)
 {
-	unsigned long	index;
-	t_mshell_var	*prev;
-	t_mshell_var	*current;
+	t_mshell_var	*var;
 
 	if (!mshell || !mshell->hash_table || !key)
 		return (EXIT_FAILURE);
-	prev = NULL;
-	index = hash_function(key);
-	current = mshell->hash_table->buckets[index];
-	while (current)
-	{
-		if (current->key && ft_strcmp(current->key, key) == 0)
-		{
-			if (prev == NULL)
-				mshell->hash_table->buckets[index] = current->next;
-			else
-				prev->next = current->next;
-			free_mshell_var(current);
-			update_env(mshell);
-			return (EXIT_SUCCESS);
-		}
-		prev = current;
-		current = current->next;
-	}
+	var = ht_remove(mshell->hash_table, key);
+	if (!var)
+		return (EXIT_SUCCESS);
+	drop_env_slot(mshell, var);
+	free_mshell_var(var);
+	mark_env_changed(mshell, NULL);
 	return (EXIT_SUCCESS);
 }
 
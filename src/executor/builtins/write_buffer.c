@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   write_buffer.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file write_buffer.c
+ * @brief Buffered output for built-in commands.
+ *
+ * Builtins that print many lines collect them in a `t_wbuf` and hand them
+ * to the kernel in large `write()` calls instead of one call per line.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Prepares an empty buffer writing to `fd`.
+ *
+ * Pending `stdio` output is flushed first so it stays ahead of the
+ * buffered bytes.
+ *
+ * @param wb Buffer to initialize.
+ * @param fd File descriptor the buffer is flushed to.
+ */
+void	wbuf_init(t_wbuf *wb, int fd)
+{
+	(void)fflush(stdout);
+	wb->fd = fd;
+	wb->len = 0;
+	wb->failed = false;
+}
+
+/**
+ * @brief Writes out everything collected so far.
+ *
+ * Retries short writes and writes interrupted by a signal.
+ *
+ * @param wb Buffer to flush.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if any write has failed
+ * (`errno` is left as set by `write()`).
+ */
+int	wbuf_flush(t_wbuf *wb)
+{
+	size_t	done;
+	ssize_t	ret;
+
+	done = 0;
+	while (!wb->failed && done < wb->len)
+	{
+		ret = write(wb->fd, wb->data + done, wb->len - done);
+		if (ret < 0 && errno == EINTR)
+			continue ;
+		if (ret < 0)
+			wb->failed = true;
+		else
+			done += (size_t)ret;
+	}
+	wb->len = 0;
+	if (wb->failed)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Appends `n` bytes to the buffer, flushing it whenever it fills.
+ *
+ * @param wb Buffer to append to.
+ * @param s Bytes to append.
+ * @param n Number of bytes.
+ */
+void	wbuf_write(t_wbuf *wb, const char *s, size_t n)
+{
+	size_t	chunk;
+
+	while (n > 0 && !wb->failed)
+	{
+		if (wb->len == WBUF_SIZE)
+			wbuf_flush(wb);
+		chunk = WBUF_SIZE - wb->len;
+		if (chunk > n)
+			chunk = n;
+		ft_memcpy(wb->data + wb->len, s, chunk);
+		wb->len += chunk;
+		s += chunk;
+		n -= chunk;
+	}
+}
+
+/**
+ * @brief Appends a NUL-terminated string to the buffer.
+ *
+ * @param wb Buffer to append to.
+ * @param s String to append.
+ */
+void	wbuf_puts(t_wbuf *wb, const char *s)
+{
+	wbuf_write(wb, s, ft_strlen(s));
+}
+
+/**
+ * @brief Reports a failed write of a builtin's output.
+ *
+ * EPIPE is only seen with SIGPIPE ignored, that is when the shell runs a
+ * pipeline stage itself (see `builtin_stage.c`): the builtin then ends
+ * quietly with the status of a stage killed by SIGPIPE.
+ *
+ * @param msg Prefix of the error message, e.g. `echo: write error`.
+ * @return `128 + SIGPIPE` for EPIPE, `EXIT_FAILURE` otherwise.
+ */
+uint8_t	wbuf_error(const char *msg)
+{
+	if (errno == EPIPE)
+		return (128 + SIGPIPE);
+	return (perror_return(msg, EXIT_FAILURE));
+}
@@ -19,8 +19,8 @@
 /**
  * @brief Creates a backup of the specified file descriptor.
  *
- * Duplicates the given file descriptor using `dup()`
- * to allow restoring it later.
+ * Duplicates the given file descriptor, close-on-exec so that commands
+ * started by the builtin do not inherit it, to allow restoring it later.
  *
  * @param fd The file descriptor to back up.
  * @return A duplicate of the file descriptor, or -1 on failure.
@@ -29,7 +29,7 @@ static int	backup_fd(int fd)
 {
 	int	backup;
 
-	backup = dup(fd);
+	backup = fcntl(fd, F_DUPFD_CLOEXEC, 0);
 	if (backup == -1)
 		return (perror_return("backup_fd: dup", -1));
 	return (backup);
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_in_place.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file exec_in_place.c
+ * @brief Replaces the shell with the last command of a one-shot run.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Runs a single external command in the shell process itself.
+ *
+ * Used when nothing follows the command (see `t_mshell->exec_last`), so
+ * the shell has no reason to fork and wait: the command is set up like a
+ * forked child and `execute_command()` execs it, or reports the error and
+ * exits with the status the child would have returned. Never returns.
+ *
+ * @param cmd Pointer to the command structure, binary already resolved.
+ */
+void	exec_in_place(t_cmd *cmd)
+{
+	t_cmd	*head;
+
+	head = get_cmd_head(cmd);
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	signal(SIGPIPE, SIG_DFL);
+	if (apply_redirections(cmd) != EXIT_SUCCESS)
+	{
+		free_minishell(&cmd->minishell);
+		free_cmd(&head);
+		_exit(EXIT_FAILURE);
+	}
+	execute_command(cmd);
+}
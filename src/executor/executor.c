@@ -40,7 +40,7 @@ static uint8_t	execute_pipeline_or_binary(t_cmd *cmd)
 	minishell = cmd->minishell;
 	exit_status = exec_in_pipes(cmd);
 	minishell->exit_status = exit_status;
-	if (is_exit_command(cmd))
+	if (!cmd->background && is_exit_command(cmd))
 		cleanup_and_exit(cmd, exit_status);
 	return (exit_status);
 }
@@ -49,8 +49,8 @@ static uint8_t	execute_pipeline_or_binary(t_cmd *cmd)
  * @brief Executes a built-in command in the current process.
  *
  * This function runs built-in commands (like `cd`, `echo`, `exit`) directly
- * without forking a child. If the command is `exit`, it performs full
- * cleanup before exiting.
+ * without forking a child and records its status in `PIPESTATUS`. If the
+ * command is `exit`, it performs full cleanup before exiting.
  *
  * @param cmd Pointer to the command structure.
  * @return Exit status of the built-in command.
@@ -63,6 +63,7 @@ static uint8_t	execute_builtin(t_cmd *cmd)
 	minishell = cmd->minishell;
 	exit_status = exec_in_current_process(cmd);
 	minishell->exit_status = exit_status;
+	set_pipestatus(minishell, &exit_status, 1);
 	if (ft_strcmp(cmd->argv[0], "exit") == 0)
 	{
 		if (isatty(STDIN_FILENO))
@@ -88,11 +89,31 @@ static uint8_t	handle_executor_signal_exit(t_cmd *cmd,	uint8_t exit_status)
 	return (exit_status);
 }
 
+/**
+ * @brief Resolves and runs a parsed command line.
+ *
+ * A single external command has its binary resolved here in the parent,
+ * where `$_` and the lookup caches need it; when it is the last command of
+ * a one-shot run it is exec'd in place. Pipeline stages resolve their own
+ * binaries in their children. A command line ending in `&`, builtins
+ * included, always runs through the pipeline code as a job.
+ *
+ * @param cmd Pointer to the first command.
+ * @return Exit status of the command line.
+ */
 uint8_t	run_executor_core(t_cmd *cmd)
 {
 	uint8_t	exit_status;
 
-	if (!is_builtin(cmd) || cmd->next)
+	if (!cmd->next && !is_builtin(cmd))
+	{
+		cmd->binary = find_binary(cmd);
+		if (cmd->minishell->exec_last && !cmd->background)
+			exec_in_place(cmd);
+	}
+	else if (cmd->next)
+		path_index_refresh(cmd->minishell);
+	if (!is_builtin(cmd) || cmd->next || cmd->background)
 		exit_status = execute_pipeline_or_binary(cmd);
 	else
 		exit_status = execute_builtin(cmd);
@@ -123,6 +144,8 @@ uint8_t	run_executor(t_cmd *cmd)
 		print_error("-minishell: run_executor, command too long\n");
 		return (EXIT_FAILURE);
 	}
+	if (check_fd_budget(cmd) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
 	exit_status = apply_heredocs(cmd);
 	if (exit_status != EXIT_SUCCESS || g_signal_flag)
 		return (handle_executor_signal_exit(cmd, exit_status));
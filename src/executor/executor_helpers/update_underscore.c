@@ -105,7 +105,7 @@ static char	*resolve_underscore_value(t_cmd *cmd, char *binary_path,
  * @brief Updates the special shell variable `_` with the last command argument.
  *
  * Mimics Bash behavior. Resolves what `_` should be set to and assigns it
- * to the environment. Also updates `env` array after setting the variable.
+ * to the environment. `set_variable()` keeps the `env` slot of `_` in sync.
  *
  * @param cmd Pointer to the command structure.
  * @param binary_path The resolved binary path of the command.
@@ -126,6 +126,4 @@ void	update_underscore(t_cmd *cmd, char *binary_path)
 	}
 	if (to_free && val)
 		free(val);
-	if (update_env(cmd->minishell) != EXIT_SUCCESS)
-		print_error("-minishell: update_underscore, update_env failed");
 }
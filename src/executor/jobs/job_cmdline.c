@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_cmdline.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file job_cmdline.c
+ * @brief Builds the text `jobs` shows for a pipeline.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Computes the length of the text shown for a pipeline.
+ *
+ * @param cmd First command of the pipeline.
+ * @return Length of the words joined by spaces and stages by ` | `.
+ */
+static size_t	cmdline_len(t_cmd *cmd)
+{
+	size_t	len;
+	int		i;
+
+	len = 0;
+	while (cmd)
+	{
+		i = 0;
+		while (cmd->argv && cmd->argv[i])
+			len += ft_strlen(cmd->argv[i++]) + 1;
+		if (cmd->next)
+			len += 2;
+		cmd = cmd->next;
+	}
+	return (len);
+}
+
+/**
+ * @brief Appends the words of one stage, each followed by a space.
+ *
+ * @param line Destination buffer.
+ * @param len Current length of `line`.
+ * @param argv Words of the stage; may be NULL.
+ * @return New length of `line`.
+ */
+static size_t	append_words(char *line, size_t len, char **argv)
+{
+	size_t	word_len;
+
+	while (argv && *argv)
+	{
+		word_len = ft_strlen(*argv);
+		ft_memcpy(line + len, *argv, word_len);
+		len += word_len;
+		line[len++] = ' ';
+		argv++;
+	}
+	return (len);
+}
+
+/**
+ * @brief Builds the text shown for a pipeline by `jobs`.
+ *
+ * Redirections are left out; the words and stages are kept.
+ *
+ * @param cmd First command of the pipeline.
+ * @return Newly allocated text, or NULL on allocation failure.
+ */
+char	*job_cmdline(t_cmd *cmd)
+{
+	char	*line;
+	size_t	len;
+
+	line = malloc(cmdline_len(cmd) + 1);
+	if (!line)
+		return (NULL);
+	len = 0;
+	while (cmd)
+	{
+		len = append_words(line, len, cmd->argv);
+		if (cmd->next)
+		{
+			ft_memcpy(line + len, "| ", 2);
+			len += 2;
+		}
+		cmd = cmd->next;
+	}
+	while (len > 0 && line[len - 1] == ' ')
+		len--;
+	line[len] = '\0';
+	return (line);
+}
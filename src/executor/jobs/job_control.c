@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_control.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file job_control.c
+ * @brief Process groups and terminal ownership of pipelines.
+ *
+ * When the shell owns its terminal, every pipeline runs in a process
+ * group of its own, led by its first stage. A foreground pipeline gets
+ * the terminal for as long as it runs, so Ctrl-C and Ctrl-Z reach only
+ * its stages, and a background one never does. Without a terminal,
+ * background stages stay in the shell's group and ignore SIGINT and
+ * SIGQUIT instead, like in other shells.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Turns job control on if the shell is in the foreground of its
+ * terminal.
+ *
+ * The shell then ignores the job control signals, so it is neither
+ * stopped by Ctrl-Z nor by taking the terminal back from a job.
+ *
+ * @param mshell Pointer to the shell instance.
+ */
+void	setup_job_control(t_mshell *mshell)
+{
+	mshell->shell_pgid = getpgrp();
+	if (!isatty(STDIN_FILENO)
+		|| tcgetpgrp(STDIN_FILENO) != mshell->shell_pgid)
+		return ;
+	mshell->job_control = true;
+	signal(SIGTSTP, SIG_IGN);
+	signal(SIGTTIN, SIG_IGN);
+	signal(SIGTTOU, SIG_IGN);
+}
+
+/**
+ * @brief Makes a process group the foreground group of the terminal.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param pgid Process group to hand the terminal to.
+ */
+void	give_terminal(t_mshell *mshell, pid_t pgid)
+{
+	if (mshell->job_control && pgid > 0)
+		tcsetpgrp(STDIN_FILENO, pgid);
+}
+
+/**
+ * @brief Records a started stage in the parent.
+ *
+ * Under job control the stage is also put in the pipeline's process
+ * group here, as the child does itself, so neither side depends on
+ * which one runs first.
+ *
+ * @param info Pipeline information.
+ * @param pid Process ID of the stage.
+ */
+void	track_stage(t_pipe_info *info, pid_t pid)
+{
+	t_mshell	*mshell;
+
+	mshell = info->cmd_list->minishell;
+	info->pids[info->count] = pid;
+	info->count++;
+	if (!mshell->job_control)
+		return ;
+	if (info->pgid == 0)
+		info->pgid = pid;
+	setpgid(pid, info->pgid);
+	if (!info->background)
+		give_terminal(mshell, info->pgid);
+}
+
+/**
+ * @brief Prepares the signals and process group of a forked stage.
+ *
+ * The terminal is taken while SIGTTOU is still ignored. Job control is
+ * turned off in the child: it is not the parent of the shell's jobs.
+ *
+ * @param mshell Pointer to the shell instance (the child's copy).
+ * @param info Pipeline information.
+ */
+void	setup_child_signals(t_mshell *mshell, t_pipe_info *info)
+{
+	if (mshell->job_control)
+	{
+		setpgid(0, info->pgid);
+		if (!info->background)
+			tcsetpgrp(STDIN_FILENO, getpgrp());
+	}
+	mshell->bg_child = info->background && !mshell->job_control;
+	mshell->job_control = false;
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	if (mshell->bg_child)
+	{
+		signal(SIGINT, SIG_IGN);
+		signal(SIGQUIT, SIG_IGN);
+	}
+	signal(SIGPIPE, SIG_DFL);
+	signal(SIGTSTP, SIG_DFL);
+	signal(SIGTTIN, SIG_DFL);
+	signal(SIGTTOU, SIG_DFL);
+}
+
+/**
+ * @brief Lists the signals a spawned stage resets to their default.
+ *
+ * Mirrors `setup_child_signals()`: SIGINT and SIGQUIT stay ignored in a
+ * background stage started without job control.
+ *
+ * @param set Signal set to fill.
+ * @param info Pipeline information.
+ */
+void	child_default_signals(sigset_t *set, t_pipe_info *info)
+{
+	sigemptyset(set);
+	if (!info->background || info->cmd_list->minishell->job_control)
+	{
+		sigaddset(set, SIGINT);
+		sigaddset(set, SIGQUIT);
+	}
+	sigaddset(set, SIGPIPE);
+	sigaddset(set, SIGTSTP);
+	sigaddset(set, SIGTTIN);
+	sigaddset(set, SIGTTOU);
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_reap.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file job_reap.c
+ * @brief Collects background jobs without blocking the shell.
+ *
+ * Before each prompt the shell reaps every child that has changed state
+ * with `waitpid(WNOHANG)`, reports finished and stopped jobs and drops
+ * the finished ones from the table. Children of a job that end while a
+ * foreground pipeline is being waited for are recorded the same way.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Finds the job a process belongs to.
+ *
+ * Reaped stages are found by passing their negated process ID.
+ *
+ * @param tbl Job table.
+ * @param pid Process ID to look for.
+ * @param stage Set to the index of the stage, if not NULL.
+ * @return The job, or NULL if no job has this process.
+ */
+t_job	*job_find_pid(t_job_tbl *tbl, pid_t pid, size_t *stage)
+{
+	size_t	i;
+	size_t	j;
+
+	i = 0;
+	while (pid != 0 && i < tbl->count)
+	{
+		j = 0;
+		while (j < tbl->jobs[i].count && tbl->jobs[i].pids[j] != pid)
+			j++;
+		if (j < tbl->jobs[i].count)
+		{
+			if (stage)
+				*stage = j;
+			return (&tbl->jobs[i]);
+		}
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Records a state change of a process that belongs to a job.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param pid Process ID returned by `waitpid()`.
+ * @param status Status returned by `waitpid()`.
+ */
+void	job_note_status(t_mshell *mshell, pid_t pid, int status)
+{
+	t_job	*job;
+	size_t	stage;
+
+	job = job_find_pid(&mshell->jobs, pid, &stage);
+	if (!job)
+		return ;
+	job->changed = true;
+	if (WIFSTOPPED(status))
+	{
+		job->state = JOB_STOPPED;
+		return ;
+	}
+	if (WIFCONTINUED(status))
+	{
+		job->state = JOB_RUNNING;
+		return ;
+	}
+	job->statuses[stage] = child_status(status, false);
+	job->pids[stage] = -pid;
+	job->live--;
+	if (job->live == 0)
+		job->state = JOB_DONE;
+}
+
+/**
+ * @brief Reaps, without blocking, every child that has changed state.
+ *
+ * @param mshell Pointer to the shell instance.
+ */
+void	poll_jobs(t_mshell *mshell)
+{
+	pid_t	pid;
+	int		status;
+	int		flags;
+
+	if (mshell->jobs.count == 0)
+		return ;
+	flags = WNOHANG;
+	if (mshell->job_control)
+		flags |= WUNTRACED | WCONTINUED;
+	pid = waitpid(-1, &status, flags);
+	while (pid > 0 || (pid == -1 && errno == EINTR))
+	{
+		if (pid > 0)
+			job_note_status(mshell, pid, status);
+		pid = waitpid(-1, &status, flags);
+	}
+}
+
+/**
+ * @brief Reports jobs that finished or stopped since the last prompt.
+ *
+ * Only done under job control, as in other shells: otherwise finished
+ * jobs stay in the table until `jobs` or `wait` reports them.
+ *
+ * @param mshell Pointer to the shell instance.
+ */
+void	reap_jobs(t_mshell *mshell)
+{
+	t_wbuf	wb;
+	size_t	i;
+
+	if (mshell->jobs.count == 0)
+		return ;
+	poll_jobs(mshell);
+	if (!mshell->job_control)
+		return ;
+	wbuf_init(&wb, STDERR_FILENO);
+	i = 0;
+	while (i < mshell->jobs.count)
+	{
+		if (mshell->jobs.jobs[i].changed
+			&& mshell->jobs.jobs[i].state != JOB_RUNNING)
+			put_job(&wb, mshell, &mshell->jobs.jobs[i]);
+		mshell->jobs.jobs[i].changed = false;
+		if (mshell->jobs.jobs[i].state == JOB_DONE)
+			job_remove(mshell, &mshell->jobs.jobs[i]);
+		else
+			i++;
+	}
+	wbuf_flush(&wb);
+}
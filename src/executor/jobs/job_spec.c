@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_spec.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file job_spec.c
+ * @brief Job specifications (`%1`, `%+`, `%-`) and the job report line.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Reports a job specification that matches no job.
+ *
+ * @param name Name of the builtin.
+ * @param spec The specification, or NULL for the current job.
+ * @return Always NULL.
+ */
+static t_job	*no_such_job(const char *name, const char *spec)
+{
+	char	error_buf[ERROR_BUF_SIZE];
+
+	if (!spec)
+		spec = "current";
+	ft_strlcpy(error_buf, name, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, ": ", ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, spec, ERROR_BUF_SIZE);
+	ft_strlcat(error_buf, ": no such job\n", ERROR_BUF_SIZE);
+	error_return(error_buf, 0);
+	return (NULL);
+}
+
+/**
+ * @brief Finds the job a job specification refers to.
+ *
+ * Accepted forms are `%%`, `%+` and `%` (or no argument) for the current
+ * job, `%-` for the previous one and `%N` or `N` for job number N.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param spec The specification, or NULL for the current job.
+ * @param name Name of the builtin, used in the error message.
+ * @return The job, or NULL (after printing an error) if there is none.
+ */
+t_job	*job_from_spec(t_mshell *mshell, const char *spec, const char *name)
+{
+	t_job_tbl	*tbl;
+	const char	*s;
+	size_t		i;
+
+	tbl = &mshell->jobs;
+	s = spec;
+	if (s && *s == '%')
+		s++;
+	if ((!s || !*s || !ft_strcmp(s, "%") || !ft_strcmp(s, "+"))
+		&& tbl->count > 0)
+		return (&tbl->jobs[tbl->count - 1]);
+	if (s && !ft_strcmp(s, "-") && tbl->count > 1)
+		return (&tbl->jobs[tbl->count - 2]);
+	if (s && !ft_strcmp(s, "-") && tbl->count == 1)
+		return (&tbl->jobs[0]);
+	i = 0;
+	while (s && ft_isdigit(*s) && is_valid_numeric_exit_arg(s)
+		&& i < tbl->count)
+	{
+		if (tbl->jobs[i].id == ft_atoi(s))
+			return (&tbl->jobs[i]);
+		i++;
+	}
+	return (no_such_job(name, spec));
+}
+
+/**
+ * @brief Returns the state shown for a job, padded to a fixed width.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param job Job to describe.
+ * @param buf Buffer of at least 32 bytes for the `Exit N` form.
+ * @return The state text.
+ */
+static const char	*job_state_text(t_mshell *mshell, t_job *job, char *buf)
+{
+	char	*num;
+	size_t	len;
+
+	if (job->state == JOB_RUNNING)
+		return ("Running                 ");
+	if (job->state == JOB_STOPPED)
+		return ("Stopped                 ");
+	if (job_status(mshell, job) == 0)
+		return ("Done                    ");
+	num = ft_itoa(job_status(mshell, job));
+	ft_strlcpy(buf, "Exit ", 32);
+	if (num)
+		ft_strlcat(buf, num, 32);
+	free(num);
+	len = ft_strlen(buf);
+	while (len < 24)
+		buf[len++] = ' ';
+	buf[len] = '\0';
+	return (buf);
+}
+
+/**
+ * @brief Returns the mark of a job: `+` for the current job, `-` for
+ * the previous one and a space for the others.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param job Job of the table.
+ * @return The mark, as a string.
+ */
+const char	*job_mark(t_mshell *mshell, t_job *job)
+{
+	size_t	idx;
+
+	idx = job - mshell->jobs.jobs;
+	if (idx + 1 == mshell->jobs.count)
+		return ("+");
+	if (idx + 2 == mshell->jobs.count)
+		return ("-");
+	return (" ");
+}
+
+/**
+ * @brief Appends the report line of a job, as printed by `jobs`.
+ *
+ * The format is `[N]+  State                   command`, where `+` marks
+ * the current job and `-` the previous one; running jobs end in ` &`.
+ *
+ * @param wb Output buffer.
+ * @param mshell Pointer to the shell instance.
+ * @param job Job to report.
+ */
+void	put_job(t_wbuf *wb, t_mshell *mshell, t_job *job)
+{
+	char	buf[32];
+	char	*num;
+
+	num = ft_itoa(job->id);
+	wbuf_puts(wb, "[");
+	if (num)
+		wbuf_puts(wb, num);
+	free(num);
+	wbuf_puts(wb, "]");
+	wbuf_puts(wb, job_mark(mshell, job));
+	wbuf_puts(wb, "  ");
+	wbuf_puts(wb, job_state_text(mshell, job, buf));
+	wbuf_puts(wb, job->cmdline);
+	if (job->state == JOB_RUNNING)
+		wbuf_puts(wb, " &");
+	wbuf_puts(wb, "\n");
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file job_table.c
+ * @brief The table of background and stopped jobs.
+ *
+ * Jobs are kept by value in an array ordered by job number; a new job
+ * takes the number after the last one, so numbers restart at 1 once the
+ * table is empty.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Counts the stages of a job that have not been reaped.
+ *
+ * @param pids Stage pids, 0 for reaped stages.
+ * @param count Number of stages.
+ * @return Number of positive pids.
+ */
+static size_t	count_live(const pid_t *pids, size_t count)
+{
+	size_t	live;
+
+	live = 0;
+	while (count-- > 0)
+		if (pids[count] > 0)
+			live++;
+	return (live);
+}
+
+/**
+ * @brief Makes room for one more job in the table.
+ *
+ * @param tbl Job table.
+ * @return true on success, false on allocation failure.
+ */
+static bool	job_tbl_reserve(t_job_tbl *tbl)
+{
+	t_job	*jobs;
+
+	if (tbl->count < tbl->cap)
+		return (true);
+	jobs = ft_realloc(tbl->jobs, tbl->cap * sizeof(t_job),
+			(tbl->cap * 2 + 4) * sizeof(t_job));
+	if (!jobs)
+		return (false);
+	tbl->jobs = jobs;
+	tbl->cap = tbl->cap * 2 + 4;
+	return (true);
+}
+
+/**
+ * @brief Adds a pipeline to the job table.
+ *
+ * The job takes over `info->pids` and `info->statuses`; stages already
+ * reaped have a pid of 0 there.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param info Pipeline information.
+ * @param state Initial state of the job.
+ * @return The new job, or NULL on allocation failure (`info` unchanged).
+ */
+t_job	*job_add(t_mshell *mshell, t_pipe_info *info, t_job_state state)
+{
+	t_job_tbl	*tbl;
+	t_job		*job;
+
+	tbl = &mshell->jobs;
+	if (!job_tbl_reserve(tbl))
+		return (NULL);
+	job = &tbl->jobs[tbl->count];
+	ft_bzero(job, sizeof(t_job));
+	job->cmdline = job_cmdline(info->cmd_list);
+	if (!job->cmdline)
+		return (NULL);
+	job->id = 1;
+	if (tbl->count > 0)
+		job->id = tbl->jobs[tbl->count - 1].id + 1;
+	job->pgid = info->pgid;
+	job->pids = info->pids;
+	job->statuses = info->statuses;
+	job->count = info->count;
+	job->live = count_live(job->pids, job->count);
+	job->state = state;
+	return (info->pids = NULL, info->statuses = NULL, tbl->count++, job);
+}
+
+/**
+ * @brief Removes a job from the table and frees it.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param job Job to remove; pointers to later jobs are invalidated.
+ */
+void	job_remove(t_mshell *mshell, t_job *job)
+{
+	t_job_tbl	*tbl;
+	size_t		idx;
+
+	tbl = &mshell->jobs;
+	idx = job - tbl->jobs;
+	free(job->pids);
+	free(job->statuses);
+	free(job->cmdline);
+	ft_memmove(job, job + 1, (tbl->count - idx - 1) * sizeof(t_job));
+	tbl->count--;
+}
+
+/**
+ * @brief Frees the job table. The jobs themselves keep running.
+ *
+ * @param tbl Job table.
+ */
+void	jobs_free(t_job_tbl *tbl)
+{
+	while (tbl->count > 0)
+	{
+		tbl->count--;
+		free(tbl->jobs[tbl->count].pids);
+		free(tbl->jobs[tbl->count].statuses);
+		free(tbl->jobs[tbl->count].cmdline);
+	}
+	free(tbl->jobs);
+	tbl->jobs = NULL;
+	tbl->cap = 0;
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_wait.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file job_wait.c
+ * @brief Blocking waits on a single job, used by `fg` and `wait`.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Computes the exit status of a finished job.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param job Finished job.
+ * @return Status of the job as for a foreground pipeline.
+ */
+uint8_t	job_status(t_mshell *mshell, t_job *job)
+{
+	return (stages_status(job->statuses, job->count, mshell->pipefail));
+}
+
+/**
+ * @brief Returns the index of a stage of the job still to be reaped.
+ *
+ * @param job Job with at least one live stage.
+ * @return Index of the first stage whose pid is positive.
+ */
+static size_t	first_live_stage(t_job *job)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < job->count && job->pids[i] <= 0)
+		i++;
+	return (i);
+}
+
+/**
+ * @brief Waits until every stage of a job has ended or the job stops.
+ *
+ * The job is marked done once nothing is left to wait for; stages that
+ * could not be waited for keep a failing status.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param job Job to wait for.
+ * @return The job's status (see `job_status()`), `128 + signal` if it
+ *         stopped, or `130` if the wait was interrupted by SIGINT.
+ */
+uint8_t	wait_for_job(t_mshell *mshell, t_job *job)
+{
+	size_t	stage;
+	pid_t	pid;
+	int		status;
+	int		flags;
+
+	flags = 0;
+	if (mshell->job_control)
+		flags = WUNTRACED;
+	while (job->live > 0)
+	{
+		stage = first_live_stage(job);
+		pid = waitpid(job->pids[stage], &status, flags);
+		if (pid == -1 && errno == EINTR)
+			return (128 + SIGINT);
+		if (pid == -1)
+			break ;
+		if (WIFSTOPPED(status))
+			return (job->state = JOB_STOPPED, 128 + WSTOPSIG(status));
+		job_note_status(mshell, pid, status);
+	}
+	job->state = JOB_DONE;
+	return (job_status(mshell, job));
+}
+
+/**
+ * @brief Waits for every running job, as `wait` without arguments does.
+ *
+ * Stopped jobs are skipped; finished jobs leave the table.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @return `0`, or `130` if the wait was interrupted by SIGINT.
+ */
+uint8_t	wait_all_jobs(t_mshell *mshell)
+{
+	size_t	i;
+
+	poll_jobs(mshell);
+	i = 0;
+	while (i < mshell->jobs.count)
+	{
+		if (mshell->jobs.jobs[i].state == JOB_RUNNING
+			&& wait_for_job(mshell, &mshell->jobs.jobs[i]) == 128 + SIGINT
+			&& g_signal_flag)
+			return (128 + SIGINT);
+		if (mshell->jobs.jobs[i].state == JOB_DONE)
+			job_remove(mshell, &mshell->jobs.jobs[i]);
+		else
+			i++;
+	}
+	return (EXIT_SUCCESS);
+}
@@ -24,21 +24,44 @@
  * @brief Creates a new pipe if the current command has a successor.
  *
  * If the current command has a `next` command (i.e., it is part of a pipeline),
- * this function creates a new pipe and updates `pipe_fd`.
+ * this function creates a new close-on-exec pipe and updates `pipe_fd`. The
+ * buffer of
+ * the pipe is sized as `MINISHELL_PIPESIZE` asks (see `pipe_size.c`).
  *
  * @param cmd Pointer to the current command.
  * @param pipe_fd Array to hold read and write pipe descriptors.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if the pipe could not be created.
  */
-void	handle_pipe_creation(t_cmd *cmd, int *pipe_fd)
+uint8_t	handle_pipe_creation(t_cmd *cmd, int *pipe_fd)
 {
 	if (cmd->next)
 	{
-		if (pipe(pipe_fd) == -1)
-		{
-			perror("-exec_in_pipes: pipe");
-			exit(EXIT_FAILURE);
-		}
+		if (pipe_cloexec(pipe_fd) == -1)
+			return (perror_return("exec_in_pipes: pipe", EXIT_FAILURE));
+		apply_pipe_size(cmd->minishell, pipe_fd[1]);
 	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Closes the pipeline descriptors still held by the parent.
+ *
+ * Used when a stage cannot be started: the stages already running see
+ * EOF or SIGPIPE and can be waited for as usual.
+ *
+ * @param info Pointer to the pipeline info context.
+ */
+void	abort_pipeline(t_pipe_info *info)
+{
+	if (info->in_fd > STDIN_FILENO)
+		close(info->in_fd);
+	if (info->pipe_fd[0] >= 0)
+		close(info->pipe_fd[0]);
+	if (info->pipe_fd[1] >= 0)
+		close(info->pipe_fd[1]);
+	info->in_fd = STDIN_FILENO;
+	info->pipe_fd[0] = -1;
+	info->pipe_fd[1] = -1;
 }
 
 /**
@@ -76,25 +99,38 @@ void	close_fds_and_prepare_next(t_cmd *cmd, int *in_fd, int *pipe_fd)
  * execution.
  *
  * Resets and assigns all internal fields including file descriptors and
- * process ID
- * storage. This structure is passed throughout the pipeline to track context.
+ * allocates one process ID and status slot per stage, so the pipeline
+ * length is only bounded by memory. This structure is passed throughout
+ * the pipeline to track context; `pids` and `statuses` are freed by
+ * `exec_in_pipes()`.
  *
  * @param info Pointer to the `t_pipe_info` structure to initialize.
  * @param cmd_list The head of the command list forming the pipeline.
  * @param pipe_fd Array to hold the pipe descriptors.
- * @param pids Array to store child process IDs.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if allocation failed.
  */
-void	init_pipe_info(t_pipe_info *info, t_cmd *cmd_list,
-						int pipe_fd[2], pid_t pids[MAX_CMDS])
+uint8_t	init_pipe_info(t_pipe_info *info, t_cmd *cmd_list, int pipe_fd[2])
 {
-	static int	idx;
+	size_t	stages;
 
 	info->in_fd = STDIN_FILENO;
 	info->pipe_fd = pipe_fd;
-	info->pids = pids;
-	idx = 0;
-	info->idx = &idx;
+	info->count = 0;
+	info->deferred = false;
+	info->builtin_fd = -1;
 	info->cmd_list = cmd_list;
 	pipe_fd[0] = -1;
 	pipe_fd[1] = -1;
+	stages = count_pipeline_stages(cmd_list);
+	info->pids = malloc(stages * sizeof(pid_t));
+	info->statuses = malloc(stages * sizeof(uint8_t));
+	if (!info->pids || !info->statuses)
+	{
+		free(info->pids);
+		free(info->statuses);
+		return (perror_return("exec_in_pipes: malloc", EXIT_FAILURE));
+	}
+	ft_memset(info->statuses, EXIT_FAILURE, stages);
+	clock_gettime(CLOCK_MONOTONIC, &info->start);
+	return (EXIT_SUCCESS);
 }
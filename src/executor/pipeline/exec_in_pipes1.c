@@ -42,46 +42,66 @@ static void	print_newline_if_sigint(uint8_t exit_status)
  * - Forks and executes the command using `handle_child_and_track()`.
  * - Cleans up file descriptors and prepares for the next command.
  *
+ * If a stage cannot be started, the remaining ones are skipped; the
+ * stages already running are still waited for by the caller.
+ *
  * @param info Pointer to the pipeline info context.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if a stage could not start.
  */
-static void	process_pipeline_commands(t_pipe_info *info)
+static uint8_t	process_pipeline_commands(t_pipe_info *info)
 {
 	t_cmd	*cmd;
 
 	cmd = info->cmd_list;
 	while (cmd)
 	{
-		handle_pipe_creation(cmd, info->pipe_fd);
-		handle_child_and_track(cmd, info);
+		if (handle_pipe_creation(cmd, info->pipe_fd) != EXIT_SUCCESS
+			|| handle_child_and_track(cmd, info) != EXIT_SUCCESS)
+		{
+			abort_pipeline(info);
+			return (EXIT_FAILURE);
+		}
 		close_fds_and_prepare_next(cmd, &info->in_fd, info->pipe_fd);
 		cmd = cmd->next;
 	}
+	return (EXIT_SUCCESS);
 }
 
 /**
  * @brief Entry point to execute a list of piped commands.
  *
  * Initializes the pipe context and processes each command in sequence.
- * Waits for all child processes to complete and returns the final exit status.
+ * A pipeline started with `&` is left running as a job; otherwise all
+ * child processes are waited for, their statuses recorded in
+ * `PIPESTATUS` and the final exit status returned.
  *
  * @param cmd_list Head of the command list forming the pipeline.
- * @return Exit status of the last command in the pipeline.
+ * @return Exit status of the pipeline (see `finish_pipeline()`), or `0`
+ *         for a background job.
  */
 uint8_t	exec_in_pipes(t_cmd *cmd_list)
 {
 	t_pipe_info			info;
-	pid_t				pids[MAX_CMDS];
 	int					pipe_fd[2];
 	uint8_t				exit_status;
+	uint8_t				launch_status;
 	struct sigaction	sa_int_original;
 
 	if (!cmd_list)
 		return (EXIT_SUCCESS);
+	if (init_pipe_info(&info, cmd_list, pipe_fd) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	init_job_info(&info, cmd_list);
 	setup_sigint_ignore(&sa_int_original);
-	init_pipe_info(&info, cmd_list, pipe_fd, pids);
-	process_pipeline_commands(&info);
+	launch_status = process_pipeline_commands(&info);
+	run_deferred_stage(&info);
 	close_all_heredoc_fds(cmd_list);
-	exit_status = wait_for_children(pids, *info.idx);
+	if (info.background)
+		exit_status = start_job(&info);
+	else
+		exit_status = finish_pipeline(&info);
+	if (launch_status != EXIT_SUCCESS)
+		exit_status = EXIT_FAILURE;
 	restore_sigint(&sa_int_original);
 	print_newline_if_sigint(exit_status);
 	return (exit_status);
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_in_pipes2.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file exec_in_pipes2.c
+ * @brief Ends a pipeline: waits for it, or leaves it running as a job.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Sets up the job part of the pipeline context.
+ *
+ * A pipeline started with `&` without job control reads from
+ * `/dev/null`, so it cannot take input meant for the shell.
+ *
+ * @param info Pointer to the pipeline info context.
+ * @param cmd_list The head of the command list forming the pipeline.
+ */
+void	init_job_info(t_pipe_info *info, t_cmd *cmd_list)
+{
+	int	fd;
+
+	info->pgid = 0;
+	info->stop_sig = 0;
+	info->background = cmd_list->background;
+	if (!info->background || cmd_list->minishell->job_control)
+		return ;
+	fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+	if (fd >= 0)
+		info->in_fd = fd;
+}
+
+/**
+ * @brief Prints `[N] PID` for a job started in the background.
+ *
+ * @param job The new job.
+ */
+static void	print_job_started(t_job *job)
+{
+	t_wbuf	wb;
+	char	*num;
+
+	wbuf_init(&wb, STDERR_FILENO);
+	num = ft_itoa(job->id);
+	wbuf_puts(&wb, "[");
+	if (num)
+		wbuf_puts(&wb, num);
+	free(num);
+	num = ft_itoa(job->pids[job->count - 1]);
+	wbuf_puts(&wb, "] ");
+	if (num)
+		wbuf_puts(&wb, num);
+	free(num);
+	wbuf_puts(&wb, "\n");
+	wbuf_flush(&wb);
+}
+
+/**
+ * @brief Leaves a pipeline started with `&` running as a job.
+ *
+ * The job takes over the pipeline's pids and statuses.
+ *
+ * @param info Pointer to the pipeline info context.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if no stage started or the
+ *         job could not be recorded.
+ */
+uint8_t	start_job(t_pipe_info *info)
+{
+	t_mshell	*mshell;
+	t_job		*job;
+	uint8_t		status;
+
+	mshell = info->cmd_list->minishell;
+	job = NULL;
+	if (info->count > 0)
+		job = job_add(mshell, info, JOB_RUNNING);
+	if (!job)
+	{
+		free(info->pids);
+		free(info->statuses);
+		if (info->count == 0)
+			return (EXIT_FAILURE);
+		return (perror_return("exec_in_pipes: malloc", EXIT_FAILURE));
+	}
+	if (mshell->job_control)
+		print_job_started(job);
+	status = EXIT_SUCCESS;
+	set_pipestatus(mshell, &status, 1);
+	return (status);
+}
+
+/**
+ * @brief Waits for a foreground pipeline and records its result.
+ *
+ * Under job control the terminal is taken back afterwards, and a
+ * pipeline that was stopped is kept as a job and reported.
+ *
+ * @param info Pointer to the pipeline info context.
+ * @return Exit status of the pipeline (see `stages_status()`), or
+ *         `128 + signal` if it was stopped.
+ */
+uint8_t	finish_pipeline(t_pipe_info *info)
+{
+	t_mshell	*mshell;
+	t_job		*job;
+	t_wbuf		wb;
+	uint8_t		status;
+
+	mshell = info->cmd_list->minishell;
+	status = wait_for_children(info);
+	if (mshell->job_control)
+		give_terminal(mshell, mshell->shell_pgid);
+	job = NULL;
+	if (info->stop_sig)
+		job = job_add(mshell, info, JOB_STOPPED);
+	if (job)
+	{
+		wbuf_init(&wb, STDERR_FILENO);
+		wbuf_puts(&wb, "\n");
+		put_job(&wb, mshell, job);
+		wbuf_flush(&wb);
+		return (set_pipestatus(mshell, &status, 1), status);
+	}
+	set_pipestatus(mshell, info->statuses, info->count);
+	free(info->pids);
+	free(info->statuses);
+	return (status);
+}
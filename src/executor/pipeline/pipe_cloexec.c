@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_cloexec.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pipe_cloexec.c
+ * @brief Pipes that are never inherited across `execve()`.
+ *
+ * Every pipe the shell creates is close-on-exec, so an exec'd child
+ * keeps only what was `dup2()`'d onto its stdin and stdout and nothing
+ * has to walk the pipeline closing fds before each exec.
+ */
+#include "minishell.h"
+#ifdef __linux__
+
+/**
+ * @brief `pipe()` with both ends close-on-exec.
+ *
+ * @param pipe_fd Receives the read and write ends.
+ * @return 0 on success, -1 with `errno` set.
+ */
+int	pipe_cloexec(int *pipe_fd)
+{
+	return (pipe2(pipe_fd, O_CLOEXEC));
+}
+
+#else
+
+/**
+ * @brief `pipe()` with both ends close-on-exec.
+ *
+ * Without `pipe2()` the flag is set right after; the shell does not
+ * fork from another thread in between.
+ *
+ * @param pipe_fd Receives the read and write ends.
+ * @return 0 on success, -1 with `errno` set.
+ */
+int	pipe_cloexec(int *pipe_fd)
+{
+	if (pipe(pipe_fd) == -1)
+		return (-1);
+	if (fcntl(pipe_fd[0], F_SETFD, FD_CLOEXEC) == -1
+		|| fcntl(pipe_fd[1], F_SETFD, FD_CLOEXEC) == -1)
+	{
+		safe_close(&pipe_fd[0]);
+		safe_close(&pipe_fd[1]);
+		return (-1);
+	}
+	return (0);
+}
+
+#endif
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_stage.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file builtin_stage.c
+ * @brief Runs a builtin that only prints inside the shell, without a fork.
+ *
+ * `echo`, `pwd`, `env` and `export` without arguments change nothing in
+ * the shell, so as the first stage of a pipeline (`env | sort`) they
+ * need no child of their own. Such a stage is set aside while the other
+ * stages start and is then run by the shell with its output on the
+ * pipe. Running it only once its reader is started means a full pipe
+ * holds the shell only while the reader runs, as waiting for a forked
+ * stage would. Under job control the reader can be stopped, which a
+ * blocked write never notices, so there the stage keeps its own child.
+ * SIGPIPE is ignored meanwhile: a write to a closed pipe fails with EPIPE
+ * and the builtin returns 141, as if SIGPIPE had killed it.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Tells whether the first stage can be run by the shell itself.
+ *
+ * Later stages keep their own child, so that the stage writing to them
+ * always has a reader. The write end kept for the stage stays open
+ * until it runs, so it is only set aside while the open file limit
+ * leaves room for the rest of the pipeline. Under job control the
+ * stage is forked, so that a stopped reader stops the whole job instead
+ * of leaving the shell stuck in a write to a full pipe.
+ *
+ * @param cmd The command of the stage.
+ * @param info Pipeline information of the current stage.
+ * @return true for `echo`, `pwd`, `env` or `export` without arguments.
+ */
+static bool	can_run_in_parent(t_cmd *cmd, t_pipe_info *info)
+{
+	struct rlimit	rl;
+	char			*name;
+
+	if (info->count != 0 || info->background || !cmd->next || !cmd->argv
+		|| !cmd->argv[0] || cmd->minishell->syntax_exit_status != 0
+		|| cmd->minishell->job_control)
+		return (false);
+	name = cmd->argv[0];
+	if (ft_strcmp(name, "echo") != 0 && ft_strcmp(name, "pwd") != 0
+		&& ft_strcmp(name, "env") != 0
+		&& (ft_strcmp(name, "export") != 0 || cmd->argv[1]))
+		return (false);
+	if (getrlimit(RLIMIT_NOFILE, &rl) != 0)
+		return (false);
+	return (rl.rlim_cur == RLIM_INFINITY
+		|| (rlim_t)info->pipe_fd[1] + PIPE_FD_RESERVE + 1 < rl.rlim_cur);
+}
+
+/**
+ * @brief Sets a builtin first stage aside, to be run by
+ * `run_deferred_stage()`.
+ *
+ * The stage keeps the write end of its pipe; like every pipe end it is
+ * close-on-exec, so the later stages do not hold it open.
+ *
+ * @param cmd The command of the stage.
+ * @param info Pointer to the pipeline information structure.
+ * @return true if the stage was set aside, false to start it as usual.
+ */
+bool	defer_builtin(t_cmd *cmd, t_pipe_info *info)
+{
+	if (!can_run_in_parent(cmd, info))
+		return (false);
+	info->builtin_fd = info->pipe_fd[1];
+	info->pipe_fd[1] = -1;
+	info->pids[info->count++] = 0;
+	info->deferred = true;
+	return (true);
+}
+
+/**
+ * @brief Runs the builtin stage with its output on `fd`.
+ *
+ * Redirections of the stage are applied on top, as for a builtin run
+ * alone (see `exec_in_current_process()`).
+ *
+ * @param cmd The command of the stage.
+ * @param fd Where the output of the stage goes.
+ * @return Exit status of the builtin, `128 + SIGPIPE` if its reader
+ *         had gone.
+ */
+static uint8_t	run_stage(t_cmd *cmd, int fd)
+{
+	struct sigaction	sa_ignore;
+	struct sigaction	sa_pipe;
+	int					saved_stdout;
+	uint8_t				status;
+
+	(void)fflush(stdout);
+	saved_stdout = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
+	if (saved_stdout == -1 || dup2(fd, STDOUT_FILENO) == -1)
+	{
+		safe_close(&saved_stdout);
+		return (perror_return("exec_in_pipes: dup2", EXIT_FAILURE));
+	}
+	sa_ignore.sa_handler = SIG_IGN;
+	sigemptyset(&sa_ignore.sa_mask);
+	sa_ignore.sa_flags = 0;
+	sigaction(SIGPIPE, &sa_ignore, &sa_pipe);
+	status = exec_in_current_process(cmd);
+	if (fflush(stdout) == EOF && errno == EPIPE)
+		status = 128 + SIGPIPE;
+	clearerr(stdout);
+	sigaction(SIGPIPE, &sa_pipe, NULL);
+	dup2(saved_stdout, STDOUT_FILENO);
+	safe_close(&saved_stdout);
+	return (status);
+}
+
+/**
+ * @brief Runs the builtin stage set aside by `defer_builtin()`, if any.
+ *
+ * Called once every other stage of the pipeline has started. The status
+ * goes to `info->statuses` and the write end is closed, so the reader
+ * sees end of file.
+ *
+ * @param info Pointer to the pipeline information structure.
+ */
+void	run_deferred_stage(t_pipe_info *info)
+{
+	if (info->builtin_fd < 0)
+		return ;
+	info->statuses[0] = run_stage(info->cmd_list, info->builtin_fd);
+	safe_close(&info->builtin_fd);
+}
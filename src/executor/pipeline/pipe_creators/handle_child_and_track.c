@@ -19,43 +19,11 @@
  * - Forking a child process in a pipeline.
  * - Duplicating pipe file descriptors (`dup2`).
  * - Applying redirections and executing commands.
- * - Closing unused heredoc file descriptors to avoid leaks.
- */
-#include "minishell.h"
-
-/**
- * @brief Closes all heredoc file descriptors in the child process,
- *        except for the current command's.
- *
- * Prevents the child process from inheriting unused heredoc pipes,
- * which could result in hanging reads or FD leaks.
  *
- * @param current The command currently being executed in the child.
- * @param full_cmd_list The full list of commands in the current pipeline.
+ * Pipe and heredoc fds are close-on-exec, so other stages' heredocs need
+ * no closing here: they go away when the child execs.
  */
-void	close_unused_heredocs_child(t_cmd *current, t_cmd *full_cmd_list)
-{
-	t_cmd	*cmd;
-	t_redir	*redir;
-	t_list	*node;
-
-	cmd = full_cmd_list;
-	while (cmd)
-	{
-		if (cmd != current)
-		{
-			node = cmd->redirs;
-			while (node)
-			{
-				redir = (t_redir *)node->content;
-				if (redir->type == R_HEREDOC && redir->fd >= 0)
-					safe_close(&redir->fd);
-				node = node->next;
-			}
-		}
-		cmd = cmd->next;
-	}
-}
+#include "minishell.h"
 
 static bool	setup_child_io(t_cmd *cmd, int in_fd, int *pipe_fd, t_cmd *cmd_list)
 {
@@ -84,7 +52,6 @@ static void	child_process(t_cmd *cmd, int in_fd, int *pipe_fd, t_cmd *cmd_list)
 	t_cmd	*head;
 
 	head = get_cmd_head(cmd);
-	close_unused_heredocs_child(cmd, cmd_list);
 	if (!setup_child_io(cmd, in_fd, pipe_fd, cmd_list))
 	{
 		free_cmd(&head);
@@ -110,35 +77,35 @@ static void	child_process(t_cmd *cmd, int in_fd, int *pipe_fd, t_cmd *cmd_list)
 /**
  * @brief Forks a child process to execute a command in a pipeline.
  *
- * - Stores the PID in the pipeline info.
- * - If in the child process, runs `child_process()`.
- * - Increments the PID index counter.
+ * - Builtins that only print are left to `defer_builtin()`, and plain
+ *   external stages are started by `spawn_and_track()` instead.
+ * - If in the child process, joins the pipeline's process group and
+ *   runs `child_process()`.
+ * - Records the stage with `track_stage()`.
  *
  * @param cmd The command to be executed in the child.
  * @param info Pointer to the pipeline information structure.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if the child could not be
+ * created.
  */
-void	handle_child_and_track(t_cmd *cmd, t_pipe_info *info)
+uint8_t	handle_child_and_track(t_cmd *cmd, t_pipe_info *info)
 {
 	pid_t	pid;
 	t_cmd	*head;
 
+	if (defer_builtin(cmd, info) || spawn_and_track(cmd, info))
+		return (EXIT_SUCCESS);
 	head = get_cmd_head(cmd);
 	pid = fork();
 	if (pid == -1)
-	{
-		perror("-exec_in_pipes: fork");
-		free_minishell(&cmd->minishell);
-		free_cmd(&head);
-		exit(EXIT_FAILURE);
-	}
-	info->pids[*info->idx] = pid;
+		return (perror_return("exec_in_pipes: fork", EXIT_FAILURE));
 	if (pid == 0)
 	{
-		signal(SIGINT, SIG_DFL);
-		signal(SIGQUIT, SIG_DFL);
-		signal(SIGPIPE, SIG_DFL);
+		setup_child_signals(cmd->minishell, info);
+		cmd->minishell->path_cache.index.read_only = true;
 		child_process(cmd, info->in_fd, info->pipe_fd, info->cmd_list);
 		free_cmd(&head);
 	}
-	(*info->idx)++;
+	track_stage(info, pid);
+	return (EXIT_SUCCESS);
 }
@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_child.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file spawn_child.c
+ * @brief Launches plain external pipeline stages with `posix_spawn`.
+ *
+ * A stage that is neither a builtin nor carries redirections needs
+ * nothing from the child but its pipe ends, so it is started through
+ * `posix_spawn()` instead of `fork()`. The C library can then use
+ * `vfork`/`CLONE_VFORK` semantics and skip copying the shell's address
+ * space. With a spawn helper running (see spawn_helper.c), the helper
+ * starts such stages instead, and also those with redirections or that
+ * need the terminal. Anything else, including every case that has to
+ * report an error, keeps the fork path in `handle_child_and_track()`.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a pipeline stage can be launched with posix_spawn.
+ *
+ * The binary is resolved here only from the command table or the
+ * `PATH` index (see `find_binary_cached()`). A stage they do not answer
+ * falls back to the fork path, where the child searches `PATH` itself
+ * and reports any error, so the parent never walks `PATH` per stage.
+ * Without a spawn helper, a stage with redirections is forked, and so
+ * is a foreground stage under job control, so that it owns the terminal
+ * before it runs.
+ *
+ * @param cmd The command of the stage.
+ * @param info Pipeline information of the current stage.
+ * @return true if the stage is a plain, resolvable external command.
+ */
+static bool	can_spawn(t_cmd *cmd, t_pipe_info *info)
+{
+	if ((cmd->minishell->spawn_fd == -1 && (cmd->redirs
+				|| (cmd->minishell->job_control && !info->background)))
+		|| !cmd->argv || !cmd->argv[0] || !cmd->argv[0][0]
+		|| cmd->minishell->syntax_exit_status != 0 || is_builtin(cmd)
+		|| is_minishell_executable(cmd)
+		|| ft_strcmp(cmd->argv[0], ".") == 0
+		|| ft_strcmp(cmd->argv[0], "..") == 0)
+		return (false);
+	if (!cmd->binary)
+		cmd->binary = find_binary_cached(cmd);
+	return (cmd->binary != NULL);
+}
+
+/**
+ * @brief Queues the stdin/stdout wiring of a stage.
+ *
+ * Mirrors `setup_child_io()`. The pipe ends themselves, like every
+ * heredoc fd of the pipeline, are close-on-exec and need no action.
+ *
+ * @param fa File actions to fill.
+ * @param info Pipeline information of the current stage.
+ * @return 0 on success, non-zero if an action could not be added.
+ */
+static int	add_stage_fds(posix_spawn_file_actions_t *fa, t_pipe_info *info)
+{
+	int	err;
+
+	err = 0;
+	if (info->pipe_fd[1] != -1)
+		err |= posix_spawn_file_actions_adddup2(fa, info->pipe_fd[1],
+				STDOUT_FILENO);
+	if (info->in_fd != STDIN_FILENO)
+		err |= posix_spawn_file_actions_adddup2(fa, info->in_fd,
+				STDIN_FILENO);
+	return (err);
+}
+
+/**
+ * @brief Sets up spawn attributes matching the forked child.
+ *
+ * Signals are reset as `setup_child_signals()` does after fork (see
+ * `child_default_signals()`) and the signal mask is cleared. Under job
+ * control the stage joins the pipeline's process group.
+ *
+ * @param attr Attributes to initialise.
+ * @param info Pipeline information of the current stage.
+ * @return 0 on success, -1 on failure (nothing to destroy then).
+ */
+static int	init_spawn_attr(posix_spawnattr_t *attr, t_pipe_info *info)
+{
+	sigset_t	defaults;
+	sigset_t	mask;
+	short		flags;
+
+	if (posix_spawnattr_init(attr) != 0)
+		return (-1);
+	child_default_signals(&defaults, info);
+	sigemptyset(&mask);
+	flags = POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK;
+	if (info->cmd_list->minishell->job_control)
+		flags |= POSIX_SPAWN_SETPGROUP;
+	if (posix_spawnattr_setsigdefault(attr, &defaults) != 0
+		|| posix_spawnattr_setsigmask(attr, &mask) != 0
+		|| posix_spawnattr_setpgroup(attr, info->pgid) != 0
+		|| posix_spawnattr_setflags(attr, flags) != 0)
+	{
+		posix_spawnattr_destroy(attr);
+		return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Starts a pipeline stage with posix_spawn when possible.
+ *
+ * On success the PID is tracked exactly like a forked child. On any
+ * failure nothing has been started and the caller falls back to fork,
+ * whose child reports the error as before. With a spawn helper running
+ * the stage is handed to it instead.
+ *
+ * @param cmd The command of the stage.
+ * @param info Pointer to the pipeline information structure.
+ * @return true if the stage was spawned, false to use the fork path.
+ */
+bool	spawn_and_track(t_cmd *cmd, t_pipe_info *info)
+{
+	posix_spawn_file_actions_t	fa;
+	posix_spawnattr_t			attr;
+	pid_t						pid;
+	int							err;
+
+	if (!can_spawn(cmd, info))
+		return (false);
+	if (cmd->minishell->spawn_fd != -1)
+		return (helper_spawn(cmd, info));
+	if (init_spawn_attr(&attr, info) != 0)
+		return (false);
+	if (posix_spawn_file_actions_init(&fa) != 0)
+		return (posix_spawnattr_destroy(&attr), false);
+	err = add_stage_fds(&fa, info);
+	if (err == 0)
+		err = posix_spawn(&pid, cmd->binary, &fa, &attr, cmd->argv,
+				cmd->minishell->env);
+	posix_spawn_file_actions_destroy(&fa);
+	posix_spawnattr_destroy(&attr);
+	if (err != 0)
+		return (false);
+	track_stage(info, pid);
+	return (true);
+}
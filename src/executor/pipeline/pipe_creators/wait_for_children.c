@@ -15,8 +15,9 @@
  * @brief Waits for all child processes in a pipeline and returns final status.
  *
  * This file implements logic to wait for multiple forked child processes,
- * typically part of a pipeline in Minishell. The exit status of the last
- * process in the pipeline is used as the final return value.
+ * typically part of a pipeline in Minishell. Children are reaped in the
+ * order they exit, which is portable and needs no pidfd or signal
+ * handler, and the status of every stage is kept.
  */
 #include "minishell.h"
 
@@ -47,16 +48,17 @@ static void	print_signal_message(int sig)
 }
 
 /**
- * @brief Interprets the status of the last child process.
+ * @brief Interprets the status of a reaped pipeline stage.
  *
  * Handles normal exits, signals (like SIGQUIT), and sets the correct
- * shell-compliant exit status. Also prints a message for signals other
- * than SIGINT.
+ * shell-compliant exit status. For the last stage of a foreground
+ * pipeline it also prints a message for signals other than SIGINT.
  *
  * @param status The status returned by waitpid().
+ * @param report Whether to print the signal message.
  * @return The computed exit status.
  */
-static uint8_t	process_child_status(int status)
+uint8_t	child_status(int status, bool report)
 {
 	int	term_sig;
 
@@ -65,14 +67,14 @@ static uint8_t	process_child_status(int status)
 	else if (WIFSIGNALED(status))
 	{
 		term_sig = WTERMSIG(status);
-		if (term_sig == SIGINT)
+		if (report && term_sig == SIGINT)
 		{
 			if (isatty(STDERR_FILENO))
 			{
 				write(STDERR_FILENO, "^C", 2);
 			}
 		}
-		else if (term_sig != 0)
+		else if (report && term_sig != 0)
 		{
 			print_signal_message(term_sig);
 		}
@@ -82,29 +84,87 @@ static uint8_t	process_child_status(int status)
 }
 
 /**
- * @brief Waits for all child processes and returns the last one’s status.
+ * @brief Finds the stage a reaped process belongs to.
  *
- * Iterates through the list of PIDs using a while loop and waits for each.
- * Only the last child’s status is used to determine the return value.
+ * @param info Pipeline information.
+ * @param pid Process ID returned by waitpid().
+ * @return Index of the stage, or `info->count` if the pid is not one of
+ *         the pipeline's children.
+ */
+static size_t	find_stage(t_pipe_info *info, pid_t pid)
+{
+	size_t	i;
+
+	i = info->count;
+	while (i > 0)
+	{
+		i--;
+		if (info->pids[i] == pid)
+			return (i);
+	}
+	return (info->count);
+}
+
+/**
+ * @brief Records a reaped child.
+ *
+ * @param info Pipeline information.
+ * @param pid Process ID returned by waitpid().
+ * @param status Status returned by waitpid().
+ * @return `true` if the child was a stage of this pipeline; other
+ *         children belong to background jobs and go to the job table.
+ */
+static bool	reap_stage(t_pipe_info *info, pid_t pid, int status)
+{
+	size_t	stage;
+
+	stage = find_stage(info, pid);
+	if (stage == info->count)
+	{
+		job_note_status(info->cmd_list->minishell, pid, status);
+		return (false);
+	}
+	info->statuses[stage] = child_status(status, stage == info->count - 1);
+	log_stage_end(info, stage);
+	info->pids[stage] = 0;
+	return (true);
+}
+
+/**
+ * @brief Waits for all stages of a pipeline in the order they finish.
+ *
+ * Every stage's status is stored in `info->statuses` and its pid cleared,
+ * so a stalled early stage no longer delays collecting the others.
+ * Builtin stages run by the shell itself already have their status. Only
+ * the last stage reports a terminating signal, as before. Under job
+ * control a stopped stage ends the wait with `info->stop_sig` set.
  *
- * @param pids Array of child process IDs.
- * @param count Number of child processes.
- * @return The exit status of the last child process.
+ * @param info Pipeline information.
+ * @return The exit status of the pipeline (see `stages_status()`).
  */
-uint8_t	wait_for_children(pid_t *pids, int count)
+uint8_t	wait_for_children(t_pipe_info *info)
 {
-	int		i;
+	size_t	reaped;
+	pid_t	pid;
 	int		status;
-	uint8_t	exit_status;
+	int		flags;
 
-	i = 0;
-	exit_status = EXIT_SUCCESS;
-	while (i < count)
+	flags = 0;
+	if (info->cmd_list->minishell->job_control)
+		flags = WUNTRACED;
+	reaped = info->deferred;
+	while (reaped < info->count)
 	{
-		waitpid(pids[i], &status, 0);
-		if (i == count - 1)
-			exit_status = process_child_status(status);
-		i++;
+		pid = waitpid(-1, &status, flags);
+		if (pid == -1 && errno == EINTR)
+			continue ;
+		if (pid == -1)
+			break ;
+		if (WIFSTOPPED(status) && find_stage(info, pid) < info->count)
+			return (info->stop_sig = WSTOPSIG(status), 128 + info->stop_sig);
+		if (reap_stage(info, pid, status))
+			reaped++;
 	}
-	return (exit_status);
+	return (stages_status(info->statuses, info->count,
+			info->cmd_list->minishell->pipefail));
 }
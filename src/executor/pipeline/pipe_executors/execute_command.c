@@ -66,12 +66,24 @@ void	exec_cmd(t_cmd *cmd)
 		free_cmd(&head);
 		_exit(exit_status);
 	}
-	signal(SIGINT, SIG_DFL);
-	signal(SIGQUIT, SIG_DFL);
+	if (!cmd->minishell->bg_child)
+	{
+		signal(SIGINT, SIG_DFL);
+		signal(SIGQUIT, SIG_DFL);
+	}
 	execve(cmd->binary, cmd->argv, cmd->minishell->env);
 	child_execve_error(cmd);
 }
 
+/**
+ * @brief Runs a command inside its child process.
+ *
+ * Pipeline stages resolve their binary here, so the stages search `PATH`
+ * in parallel instead of one after another in the parent. A single
+ * command arrives already resolved by `run_executor_core()`.
+ *
+ * @param cmd Pointer to the command structure.
+ */
 void	execute_command_core(t_cmd *cmd)
 {
 	t_cmd	*head;
@@ -83,6 +95,8 @@ void	execute_command_core(t_cmd *cmd)
 		free_cmd(&head);
 		_exit(EXIT_FAILURE);
 	}
+	if (!cmd->binary && !is_builtin(cmd))
+		cmd->binary = find_binary(cmd);
 	if (!cmd->binary)
 	{
 		if (is_builtin(cmd))
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_limits.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pipe_limits.c
+ * @brief Sizes a pipeline before it is started.
+ *
+ * A pipeline holds one process ID per stage and, in the parent, only the
+ * current pipe plus the previous read end at a time. Its file descriptor
+ * needs therefore grow with the number of here-documents, which are all
+ * open before the first stage starts.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Counts the stages of a pipeline.
+ *
+ * @param cmd_list Head of the pipeline.
+ * @return Number of commands in the list.
+ */
+size_t	count_pipeline_stages(t_cmd *cmd_list)
+{
+	size_t	count;
+
+	count = 0;
+	while (cmd_list)
+	{
+		count++;
+		cmd_list = cmd_list->next;
+	}
+	return (count);
+}
+
+/**
+ * @brief Counts the here-documents of a pipeline that get a descriptor.
+ *
+ * Only a stage's last input redirection is kept open; heredocs shadowed
+ * by a later `<` or `<<` are read past without one.
+ *
+ * @param cmd_list Head of the pipeline.
+ * @return Number of stages whose stdin is a `<<`.
+ */
+static size_t	count_heredocs(t_cmd *cmd_list)
+{
+	size_t	count;
+	t_redir	*last_input;
+
+	count = 0;
+	while (cmd_list)
+	{
+		last_input = last_input_redir(cmd_list->redirs);
+		if (last_input && last_input->type == R_HEREDOC)
+			count++;
+		cmd_list = cmd_list->next;
+	}
+	return (count);
+}
+
+/**
+ * @brief Checks that a pipeline fits in the open file limit.
+ *
+ * Besides stdio and the here-documents, a single command needs one spare
+ * descriptor (a redirection or a here-document's write end) and a
+ * pipeline the `PIPE_FD_RESERVE` descriptors of its current stage.
+ * Called before the here-documents are read, so a command line that
+ * cannot run fails up front instead of halfway through.
+ *
+ * @param cmd_list Head of the pipeline.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` after printing an error.
+ */
+uint8_t	check_fd_budget(t_cmd *cmd_list)
+{
+	struct rlimit	limit;
+	size_t			needed;
+
+	if (getrlimit(RLIMIT_NOFILE, &limit) != 0
+		|| limit.rlim_cur == RLIM_INFINITY)
+		return (EXIT_SUCCESS);
+	needed = STDERR_FILENO + 1 + count_heredocs(cmd_list);
+	if (cmd_list->next)
+		needed += PIPE_FD_RESERVE;
+	else
+		needed += 1;
+	if (needed <= limit.rlim_cur)
+		return (EXIT_SUCCESS);
+	print_error("-minishell: pipeline exceeds the open file limit\n");
+	return (EXIT_FAILURE);
+}
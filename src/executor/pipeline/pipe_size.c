@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_size.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pipe_size.c
+ * @brief Buffer size of the pipes between pipeline stages.
+ *
+ * `MINISHELL_PIPESIZE` picks the size: a byte count with an optional
+ * `K`/`M` suffix. Sizes are capped at `/proc/sys/fs/pipe-max-size`;
+ * anything else keeps the system default.
+ */
+#include "minishell.h"
+#ifdef F_SETPIPE_SZ
+
+/**
+ * @brief Reads the largest pipe size an unprivileged process may set.
+ */
+static int	read_pipe_max(void)
+{
+	char		buf[32];
+	ssize_t		len;
+	int			fd;
+	long long	max;
+
+	fd = open("/proc/sys/fs/pipe-max-size", O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (PIPE_DEFAULT_MAX);
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return (PIPE_DEFAULT_MAX);
+	buf[len] = '\0';
+	max = ft_atoll(buf);
+	if (max <= 0 || max > INT_MAX)
+		return (PIPE_DEFAULT_MAX);
+	return ((int)max);
+}
+
+/**
+ * @brief Parses a `MINISHELL_PIPESIZE` byte count.
+ *
+ * @return The size capped at `max`, or 0 when `value` is not a
+ *         positive number with an optional `K` or `M` suffix.
+ */
+static int	parse_pipe_size(const char *value, int max)
+{
+	long	size;
+
+	size = 0;
+	while (ft_isdigit(*value))
+	{
+		if (size <= max)
+			size = size * 10 + (*value - '0');
+		value++;
+	}
+	if (*value == 'K' || *value == 'k')
+		size *= 1024;
+	else if (*value == 'M' || *value == 'm')
+		size *= 1024 * 1024;
+	if (*value && ft_strchr("KkMm", *value))
+		value++;
+	if (*value || size <= 0)
+		return (0);
+	if (size > max)
+		return (max);
+	return ((int)size);
+}
+
+/**
+ * @brief Re-reads `MINISHELL_PIPESIZE` when it has changed.
+ */
+static void	refresh_pipe_size(t_mshell *mshell)
+{
+	const char	*value;
+
+	if (!var_cache_changed(mshell, &mshell->pipe_cache))
+		return ;
+	if (mshell->pipe_max == 0)
+		mshell->pipe_max = read_pipe_max();
+	value = mshell->pipe_cache.value;
+	mshell->pipe_size = 0;
+	if (value)
+		mshell->pipe_size = parse_pipe_size(value, mshell->pipe_max);
+}
+
+/**
+ * @brief Gives a new inter-stage pipe the buffer size the user asked for.
+ *
+ * A failed `F_SETPIPE_SZ` (e.g. the user's pipe buffer quota is used up)
+ * leaves the pipe at its current size; the pipeline works either way.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ * @param fd     Either end of the new pipe.
+ */
+void	apply_pipe_size(t_mshell *mshell, int fd)
+{
+	refresh_pipe_size(mshell);
+	if (mshell->pipe_size > 0)
+		(void)fcntl(fd, F_SETPIPE_SZ, mshell->pipe_size);
+}
+
+#endif
@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_size_stub.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pipe_size_stub.c
+ * @brief Pipe sizing for systems without `F_SETPIPE_SZ`.
+ *
+ * Pipe buffers cannot be resized there, so `MINISHELL_PIPESIZE` is
+ * ignored.
+ */
+#include "minishell.h"
+#ifndef F_SETPIPE_SZ
+
+/**
+ * @brief Does nothing: the pipe keeps the system's buffer size.
+ */
+void	apply_pipe_size(t_mshell *mshell, int fd)
+{
+	(void)mshell;
+	(void)fd;
+}
+
+#endif
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_status.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pipe_status.c
+ * @brief Per-stage results of a pipeline.
+ *
+ * - `$PIPESTATUS` expands to the exit status of every stage of the last
+ *   foreground command, separated by spaces (e.g. `0 1 0`).
+ * - With `set -o pipefail` the pipeline returns the status of its last
+ *   failing stage.
+ * - In debug mode the time each stage ended is printed.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Prints, in debug mode, when a pipeline stage ended.
+ *
+ * The time is measured from the moment the pipeline was set up.
+ *
+ * @param info Pipeline information.
+ * @param stage Index of the stage that was reaped.
+ */
+void	log_stage_end(t_pipe_info *info, size_t stage)
+{
+	struct timespec	now;
+	long			usec;
+
+	if (!is_debug_mode())
+		return ;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	usec = (now.tv_sec - info->start.tv_sec) * 1000000L
+		+ (now.tv_nsec - info->start.tv_nsec) / 1000L;
+	debug_printf("pipeline: stage %d (pid %d) ended with %d after %d us\n",
+		(int)stage, (int)info->pids[stage], (int)info->statuses[stage],
+		(int)usec);
+}
+
+/**
+ * @brief Computes the exit status of a pipeline from its stages.
+ *
+ * @param statuses Status of each stage.
+ * @param count Number of stages.
+ * @param pipefail Whether `set -o pipefail` is on.
+ * @return The last stage's status, or with `pipefail` the status of the
+ *         last stage that failed (`0` if none did).
+ */
+uint8_t	stages_status(const uint8_t *statuses, size_t count, bool pipefail)
+{
+	size_t	i;
+
+	if (count == 0)
+		return (EXIT_SUCCESS);
+	if (!pipefail)
+		return (statuses[count - 1]);
+	i = count;
+	while (i > 0)
+	{
+		i--;
+		if (statuses[i] != EXIT_SUCCESS)
+			return (statuses[i]);
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Writes a status in decimal.
+ *
+ * @param buf Destination, at least 3 bytes.
+ * @param status Status to write.
+ * @return Number of bytes written.
+ */
+static size_t	put_status(char *buf, uint8_t status)
+{
+	size_t	len;
+
+	len = 0;
+	if (status >= 100)
+		buf[len++] = '0' + status / 100;
+	if (status >= 10)
+		buf[len++] = '0' + status / 10 % 10;
+	buf[len++] = '0' + status % 10;
+	return (len);
+}
+
+/**
+ * @brief Records the statuses of the last foreground command for
+ * `$PIPESTATUS`.
+ *
+ * Kept in `t_mshell->pipestatus` rather than in the variable table, so it
+ * is not exported to children like every assigned variable is.
+ *
+ * @param mshell Pointer to the shell instance.
+ * @param statuses Status of each stage.
+ * @param count Number of stages.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` on allocation failure.
+ */
+int	set_pipestatus(t_mshell *mshell, const uint8_t *statuses, size_t count)
+{
+	char	*value;
+	size_t	len;
+	size_t	i;
+
+	value = malloc(count * 4 + 1);
+	if (!value)
+		return (perror_return("set_pipestatus: malloc", EXIT_FAILURE));
+	len = 0;
+	i = 0;
+	while (i < count)
+	{
+		if (i > 0)
+			value[len++] = ' ';
+		len += put_status(value + len, statuses[i]);
+		i++;
+	}
+	value[len] = '\0';
+	free(mshell->pipestatus);
+	mshell->pipestatus = value;
+	return (EXIT_SUCCESS);
+}
@@ -74,7 +74,8 @@ void	handle_empty_command(t_cmd *cmd)
  * @brief Increments the `SHLVL` environment variable.
  *
  * Called when Minishell is executed from within itself. Updates the internal
- * hash table and exported environment.
+ * hash table and exported environment. The parsed level is cached and only
+ * re-parsed after `SHLVL` itself changed.
  *
  * @param cmd Pointer to the command structure.
  * @return `EXIT_SUCCESS` (0) on success, or `EXIT_FAILURE` (1)
@@ -82,26 +83,26 @@ void	handle_empty_command(t_cmd *cmd)
  */
 uint8_t	update_shlvl(t_cmd *cmd)
 {
-	char	*str_shlvl;
-	int		shlvl;
-	char	*new_shlvl;
+	t_mshell	*mshell;
+	char		*new_shlvl;
 
-	str_shlvl = ms_getenv(cmd->minishell, "SHLVL");
-	if (str_shlvl != NULL)
-		shlvl = ft_atoi(str_shlvl) + 1;
-	else
-		shlvl = 1;
-	new_shlvl = ft_itoa(shlvl);
+	mshell = cmd->minishell;
+	if (var_cache_changed(mshell, &mshell->shlvl_cache))
+	{
+		mshell->shlvl = 0;
+		if (mshell->shlvl_cache.value)
+			mshell->shlvl = ft_atoi(mshell->shlvl_cache.value);
+	}
+	new_shlvl = ft_itoa(mshell->shlvl + 1);
 	if (!new_shlvl)
 		return (EXIT_FAILURE);
-	if (set_variable(cmd->minishell, "SHLVL", new_shlvl, 1) != EXIT_SUCCESS)
+	if (set_variable(mshell, "SHLVL", new_shlvl, 1) != EXIT_SUCCESS)
 	{
+		free(new_shlvl);
 		print_error("-minishell: update_shlvl, set_variable failed\n");
 		return (EXIT_FAILURE);
 	}
 	free(new_shlvl);
-	if (update_env(cmd->minishell) != EXIT_SUCCESS)
-		perror_return("update_shlvl, update_env failed\n", EXIT_FAILURE);
 	return (EXIT_SUCCESS);
 }
 
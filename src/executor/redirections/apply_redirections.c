@@ -16,7 +16,7 @@ static int	handle_file_input_redirection(t_redir *r)
 {
 	int	fd;
 
-	fd = open(r->filename, O_RDONLY);
+	fd = open(r->filename, O_RDONLY | O_CLOEXEC);
 	if (fd == -1)
 		return (perror_return(r->filename, REDIR_ERR));
 	if (dup2(fd, STDIN_FILENO) == -1)
@@ -34,7 +34,7 @@ static int	handle_output_redirection(t_redir *r, int *last_out_fd)
 	int	fd;
 
 	safe_close(last_out_fd);
-	flags = O_WRONLY | O_CREAT;
+	flags = O_WRONLY | O_CREAT | O_CLOEXEC;
 	if (r->type == R_APPEND)
 		flags |= O_APPEND;
 	else
@@ -34,28 +34,36 @@ void	safe_close(int *fd)
 }
 
 /**
- * @brief Checks if the total heredoc input exceeds the allowed limit.
- *
- * Used to prevent excessively large heredoc input that could cause
- * memory or performance issues.
+ * @brief Checks whether a redirection is of type heredoc (`<<`).
  *
- * @param total_written The current size of heredoc input in bytes.
- * @return true if the limit is exceeded, false otherwise.
+ * @param redirection Pointer to the redirection.
+ * @return true if the redirection is a heredoc, false otherwise.
  */
-bool	heredoc_exceeds_limit(size_t total_written)
+bool	is_heredoc(t_redir *redirection)
 {
-	return (total_written >= HEREDOC_MAX_SIZE);
+	return (redirection->type == R_HEREDOC);
 }
 
 /**
- * @brief Checks whether a redirection is of type heredoc (`<<`).
+ * @brief Finds the input redirection that becomes a command's stdin.
  *
- * @param redirection Pointer to the redirection.
- * @return true if the redirection is a heredoc, false otherwise.
+ * @param redirs The command's redirections.
+ * @return The last `<` or `<<`, or NULL if there is none.
  */
-bool	is_heredoc(t_redir *redirection)
+t_redir	*last_input_redir(t_list *redirs)
 {
-	return (redirection->type == R_HEREDOC);
+	t_redir	*last;
+	t_redir	*redirection;
+
+	last = NULL;
+	while (redirs)
+	{
+		redirection = redirs->content;
+		if (redirection->type == R_INPUT || redirection->type == R_HEREDOC)
+			last = redirection;
+		redirs = redirs->next;
+	}
+	return (last);
 }
 
 /**
@@ -10,84 +10,106 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+/**
+ * @file apply_heredoc_utils1.c
+ * @brief Moving a heredoc body from its pipe to a file.
+ */
 #include "minishell.h"
 
-static void	pre_heredoc_setup(t_cmd *current, t_cmd *full_cmd_list,
-		int *pipe_fd)
+/**
+ * @brief Moves what the heredoc pipe holds into a new heredoc file.
+ *
+ * Only needed where a pipe holds less than `HEREDOC_BUF_SIZE`; the pipe
+ * is closed and the body continues in the file.
+ *
+ * @param ctx Heredoc context; `file_fd` is set on success.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
+ */
+static int	spill_heredoc_to_file(t_heredoc_ctx *ctx)
 {
-	signal(SIGINT, heredoc_sigint_handler);
-	close_unused_heredocs_child(current, full_cmd_list);
-	safe_close(&pipe_fd[0]);
-	close_all_heredoc_fds(current);
-}
-
-static void	post_heredoc_cleanup(t_cmd *cmd, t_cmd *full_cmd_list, int *pipe_fd,
-		int write_result)
-{
-	t_cmd	*head;
+	char			buf[4096];
+	struct iovec	iov;
+	ssize_t			n;
 
-	close_all_heredoc_fds(full_cmd_list);
-	safe_close(&pipe_fd[1]);
-	head = get_cmd_head(cmd);
-	free_minishell(&cmd->minishell);
-	free_cmd(&head);
-	if (write_result == WRITE_HERED_ERR)
-		_exit(EXIT_FAILURE);
-	else if (write_result == HEREDOC_INTERRUPTED)
-		_exit(HEREDOC_INTERRUPTED);
-	_exit(EXIT_SUCCESS);
+	ctx->file_fd = open_heredoc_file();
+	if (ctx->file_fd == -1)
+		return (perror_return("heredoc: file", WRITE_HERED_ERR));
+	safe_close(&ctx->pipe_fd[1]);
+	n = read(ctx->pipe_fd[0], buf, sizeof(buf));
+	while (n != 0)
+	{
+		if (n == -1 && errno != EINTR)
+			return (perror_return("heredoc: read", WRITE_HERED_ERR));
+		if (n > 0)
+		{
+			iov.iov_base = buf;
+			iov.iov_len = n;
+			if (heredoc_writev(ctx->file_fd, &iov, 1) == -1)
+				return (perror_return("heredoc: write", WRITE_HERED_ERR));
+		}
+		n = read(ctx->pipe_fd[0], buf, sizeof(buf));
+	}
+	safe_close(&ctx->pipe_fd[0]);
+	return (EXIT_SUCCESS);
 }
 
-void	handle_heredoc_child(t_heredoc_exec_ctx ctx)
+/**
+ * @brief Writes a buffered body to a new pipe, or to a file if it
+ *        does not fit.
+ *
+ * @param ctx Heredoc context with no file yet.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
+ */
+static int	flush_to_pipe(t_heredoc_ctx *ctx)
 {
-	int	write_result;
+	struct iovec	iov;
 
-	pre_heredoc_setup(ctx.current, ctx.full_cmd_list, ctx.pipe_fd);
-	write_result = write_heredoc_to_pipe(ctx.cmd, ctx.pipe_fd[1], ctx.delim);
-	post_heredoc_cleanup(ctx.cmd, ctx.full_cmd_list, ctx.pipe_fd, write_result);
+	if (pipe_cloexec(ctx->pipe_fd) == -1)
+		return (perror_return("heredoc: pipe", WRITE_HERED_ERR));
+	if (fcntl(ctx->pipe_fd[1], F_SETFL, O_NONBLOCK) == -1)
+		return (perror_return("heredoc: fcntl", WRITE_HERED_ERR));
+	iov.iov_base = ctx->buf;
+	iov.iov_len = ctx->len;
+	if (heredoc_writev(ctx->pipe_fd[1], &iov, 1) == 0)
+		return (EXIT_SUCCESS);
+	if (errno != EAGAIN)
+		return (perror_return("heredoc: write", WRITE_HERED_ERR));
+	if (spill_heredoc_to_file(ctx) == WRITE_HERED_ERR)
+		return (WRITE_HERED_ERR);
+	if (heredoc_writev(ctx->file_fd, &iov, 1) == -1)
+		return (perror_return("heredoc: write", WRITE_HERED_ERR));
+	return (EXIT_SUCCESS);
 }
 
-static int	handle_heredoc_status(int status, int *pipe_fd,
-		t_cmd *full_cmd_list)
+/**
+ * @brief Returns the fd the command reads a complete heredoc from.
+ *
+ * A body that fit the buffer is written to a pipe in one go. A larger
+ * one already continues in a file: the rest of the buffer is appended,
+ * and the file is sealed and rewound.
+ *
+ * @param ctx Heredoc context.
+ * @return The fd, or WRITE_HERED_ERR (the caller closes what is open).
+ */
+int	finish_heredoc(t_heredoc_ctx *ctx)
 {
-	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGINT)
-	{
-		safe_close(&pipe_fd[0]);
-		close_all_heredoc_fds(full_cmd_list);
-		g_signal_flag = 1;
-		return (HEREDOC_INTERRUPTED);
-	}
-	if (WIFEXITED(status))
+	struct iovec	iov;
+
+	iov.iov_base = ctx->buf;
+	iov.iov_len = ctx->len;
+	if (ctx->file_fd != -1)
 	{
-		if (WEXITSTATUS(status) == HEREDOC_INTERRUPTED)
-		{
-			safe_close(&pipe_fd[0]);
-			close_all_heredoc_fds(full_cmd_list);
-			g_signal_flag = 1;
-			return (HEREDOC_INTERRUPTED);
-		}
-		if (WEXITSTATUS(status) != EXIT_SUCCESS)
-		{
-			safe_close(&pipe_fd[0]);
-			close_all_heredoc_fds(full_cmd_list);
-			return (WRITE_HERED_ERR);
-		}
+		if (heredoc_writev(ctx->file_fd, &iov, 1) == -1)
+			return (perror_return("heredoc: write", WRITE_HERED_ERR));
 	}
-	return (pipe_fd[0]);
-}
-
-int	handle_heredoc_parent(pid_t pid, int *pipe_fd, t_cmd *full_cmd_list)
-{
-	int	status;
-
-	safe_close(&pipe_fd[1]);
-	signal(SIGINT, SIG_IGN);
-	waitpid(pid, &status, 0);
-	signal(SIGINT, handle_sigint);
-	if (g_signal_flag)
+	else if (flush_to_pipe(ctx) == WRITE_HERED_ERR)
+		return (WRITE_HERED_ERR);
+	if (ctx->file_fd == -1)
 	{
-		safe_close(&pipe_fd[0]);
-		return (HEREDOC_INTERRUPTED);
+		safe_close(&ctx->pipe_fd[1]);
+		return (ctx->pipe_fd[0]);
 	}
-	return (handle_heredoc_status(status, pipe_fd, full_cmd_list));
+	if (seal_heredoc_file(ctx->file_fd) == -1)
+		return (perror_return("heredoc: seal", WRITE_HERED_ERR));
+	return (ctx->file_fd);
 }
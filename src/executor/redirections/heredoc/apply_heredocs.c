@@ -12,50 +12,80 @@
 
 #include "minishell.h"
 
-static int	new_heredoc_fd(t_cmd *cmd,
-		const char *delim,
-		t_cmd *current,
-		t_cmd *full_cmd_list)
+/**
+ * @brief Prepares the context for reading one heredoc.
+ *
+ * @param ctx Context to fill; its buffer is left as is.
+ * @param cmd The command that owns the heredoc.
+ * @param redirection The heredoc redirection.
+ * @param discard Whether the body is only read past (see
+ *        `handle_cmd_heredocs()`).
+ */
+static void	init_heredoc_ctx(t_heredoc_ctx *ctx, t_cmd *cmd,
+		t_redir *redirection, bool discard)
 {
-	int					pipe_fd[2];
-	pid_t				pid;
-	t_heredoc_exec_ctx	ctx;
+	ctx->pipe_fd[0] = -1;
+	ctx->pipe_fd[1] = -1;
+	ctx->file_fd = -1;
+	ctx->delim = redirection->filename;
+	ctx->mshell = cmd->minishell;
+	ctx->expand = redirection->expand_in_heredoc;
+	ctx->discard = discard;
+	ctx->len = 0;
+}
+
+/**
+ * @brief Reads one heredoc body and returns the fd to read it from.
+ *
+ * @param cmd The command that owns the heredoc.
+ * @param redirection The heredoc redirection.
+ * @param discard Whether to drop the body instead of storing it.
+ * @return The pipe's read end or the sealed file holding the body, -1
+ *         for a discarded body, WRITE_HERED_ERR or HEREDOC_INTERRUPTED.
+ */
+static int	new_heredoc_fd(t_cmd *cmd, t_redir *redirection, bool discard)
+{
+	t_heredoc_ctx	ctx;
+	int				ret;
 
-	if (pipe(pipe_fd) == -1)
-		return (perror_return("new_heredoc_fd: pipe", WRITE_HERED_ERR));
-	pid = fork();
-	if (pid == -1)
+	init_heredoc_ctx(&ctx, cmd, redirection, discard);
+	ret = write_heredoc_to_pipe(&ctx);
+	if (ret == EXIT_SUCCESS && !g_signal_flag && discard)
+		return (-1);
+	if (ret == EXIT_SUCCESS && !g_signal_flag)
 	{
-		safe_close(&pipe_fd[0]);
-		safe_close(&pipe_fd[1]);
-		return (perror_return("new_heredoc_fd: fork", WRITE_HERED_ERR));
+		ret = finish_heredoc(&ctx);
+		if (ret != WRITE_HERED_ERR)
+			return (ret);
 	}
-	ctx.cmd = cmd;
-	ctx.delim = delim;
-	ctx.current = current;
-	ctx.full_cmd_list = full_cmd_list;
-	ctx.pipe_fd = pipe_fd;
-	if (pid == 0)
-		handle_heredoc_child(ctx);
-	return (handle_heredoc_parent(pid, pipe_fd, full_cmd_list));
+	safe_close(&ctx.pipe_fd[0]);
+	safe_close(&ctx.pipe_fd[1]);
+	safe_close(&ctx.file_fd);
+	if (g_signal_flag)
+		return (HEREDOC_INTERRUPTED);
+	return (WRITE_HERED_ERR);
 }
 
-static bool	assign_heredoc_fd(t_cmd *cmd,
-		t_redir *redirection,
-		t_cmd *current,
-		t_cmd *full_cmd_list)
+/**
+ * @brief Reads the body of one heredoc into `redirection->fd`.
+ *
+ * After SIGINT readline has already ended the line, so only its state is
+ * reset for the next prompt.
+ *
+ * @param cmd The command that owns the heredoc.
+ * @param redirection The heredoc redirection.
+ * @param discard Whether the heredoc is shadowed.
+ * @return false on error, true otherwise (including SIGINT).
+ */
+static bool	assign_heredoc_fd(t_cmd *cmd, t_redir *redirection, bool discard)
 {
-	redirection->fd = new_heredoc_fd(cmd,
-			redirection->filename,
-			current,
-			full_cmd_list);
+	redirection->fd = new_heredoc_fd(cmd, redirection, discard);
 	if (redirection->fd == WRITE_HERED_ERR)
 		return (false);
 	if (redirection->fd == HEREDOC_INTERRUPTED)
 	{
 		if (isatty(STDOUT_FILENO) && isatty(STDIN_FILENO))
 		{
-			write(STDOUT_FILENO, "\n", 1);
 			rl_replace_line("", 0);
 			rl_on_new_line();
 		}
@@ -66,18 +96,32 @@ static bool	assign_heredoc_fd(t_cmd *cmd,
 	return (true);
 }
 
-static bool	handle_cmd_heredocs(t_cmd *cmd, t_cmd *full_cmd_list)
+/**
+ * @brief Reads the heredocs of one command.
+ *
+ * Only the last input redirection of a command becomes its stdin, so a
+ * heredoc followed by another `<` or `<<` is shadowed: its lines are
+ * still consumed up to the delimiter but dropped unexpanded, and it gets
+ * no pipe, file or fd.
+ *
+ * @param cmd The command.
+ * @return false on error, true otherwise.
+ */
+static bool	handle_cmd_heredocs(t_cmd *cmd)
 {
 	t_list	*redir_list;
 	t_redir	*redirection;
+	t_redir	*last_input;
 
 	redir_list = cmd->redirs;
-	while (redir_list)
+	last_input = last_input_redir(cmd->redirs);
+	while (redir_list && !g_signal_flag)
 	{
 		redirection = redir_list->content;
 		if (is_heredoc(redirection))
 		{
-			if (!assign_heredoc_fd(cmd, redirection, cmd, full_cmd_list))
+			if (!assign_heredoc_fd(cmd, redirection,
+					redirection != last_input))
 				return (false);
 		}
 		redir_list = redir_list->next;
@@ -85,6 +129,15 @@ static bool	handle_cmd_heredocs(t_cmd *cmd, t_cmd *full_cmd_list)
 	return (true);
 }
 
+/**
+ * @brief Reads the bodies of all heredocs of a command line, in order.
+ *
+ * Bodies are read by the shell itself; after SIGINT the remaining
+ * heredocs are left unread and `g_signal_flag` stays set for the caller.
+ *
+ * @param cmd The first command of the command line.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with all heredoc fds closed.
+ */
 uint8_t	apply_heredocs(t_cmd *cmd)
 {
 	t_cmd	*initial_cmd_list;
@@ -92,9 +145,9 @@ uint8_t	apply_heredocs(t_cmd *cmd)
 	initial_cmd_list = cmd;
 	if (!cmd)
 		return (error_return("apply_heredocs: cmd not found\n", EXIT_FAILURE));
-	while (cmd)
+	while (cmd && !g_signal_flag)
 	{
-		if (!handle_cmd_heredocs(cmd, initial_cmd_list))
+		if (!handle_cmd_heredocs(cmd))
 		{
 			close_all_heredoc_fds(initial_cmd_list);
 			return (error_return("apply_heredocs: failed\n", EXIT_FAILURE));
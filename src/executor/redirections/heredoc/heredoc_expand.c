@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_expand.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file heredoc_expand.c
+ * @brief Expansion of heredoc lines straight into the heredoc buffer.
+ *
+ * As in bash, a heredoc body with an unquoted delimiter only expands
+ * `$` and removes the backslash before `$`, `\` and `` ` ``; quotes and
+ * `~` are kept as they are. Values are copied from the variable table
+ * into the buffer without building an intermediate string.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Writes `$?`, the last exit status.
+ *
+ * @param ctx Heredoc context.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
+ */
+static int	put_status(t_heredoc_ctx *ctx)
+{
+	char	digits[3];
+	int		n;
+	int		status;
+
+	n = 3;
+	status = ctx->mshell->exit_status;
+	while (n == 3 || status > 0)
+	{
+		n--;
+		digits[n] = '0' + status % 10;
+		status /= 10;
+	}
+	return (heredoc_put(ctx, digits + n, 3 - n));
+}
+
+/**
+ * @brief Writes the value of a variable; unset variables expand to "".
+ *
+ * The name is looked up in place, terminated for the lookup only.
+ *
+ * @param ctx Heredoc context.
+ * @param name Start of the name in the line.
+ * @param len Length of the name.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
+ */
+static int	put_var(t_heredoc_ctx *ctx, char *name, size_t len)
+{
+	char	saved;
+	char	*value;
+
+	saved = name[len];
+	name[len] = '\0';
+	if (ft_strcmp(name, "PIPESTATUS") == 0 && ctx->mshell->pipestatus)
+		value = ctx->mshell->pipestatus;
+	else
+		value = ms_getenv(ctx->mshell, name);
+	name[len] = saved;
+	if (!value)
+		return (EXIT_SUCCESS);
+	return (heredoc_put(ctx, value, ft_strlen(value)));
+}
+
+/**
+ * @brief Expands what follows a `$`: `?`, a name or a single digit.
+ *
+ * A `$` that starts none of these is written as is.
+ *
+ * @param ctx Heredoc context.
+ * @param s Position after the `$`; advanced past what was expanded.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
+ */
+static int	put_dollar(t_heredoc_ctx *ctx, char **s)
+{
+	char	*name;
+	size_t	len;
+
+	name = *s;
+	if (*name == '?')
+		return ((*s)++, put_status(ctx));
+	len = 0;
+	if (ft_isdigit(*name))
+		len = 1;
+	while (!ft_isdigit(*name) && (ft_isalnum(name[len]) || name[len] == '_'))
+		len++;
+	if (len == 0)
+		return (heredoc_put(ctx, "$", 1));
+	*s += len;
+	return (put_var(ctx, name, len));
+}
+
+/**
+ * @brief Handles a `$` or `\` at `*s`.
+ *
+ * @param ctx Heredoc context.
+ * @param s Position of the character; advanced past what was consumed.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
+ */
+static int	put_special(t_heredoc_ctx *ctx, char **s)
+{
+	char	c;
+
+	c = **s;
+	(*s)++;
+	if (c == '$')
+		return (put_dollar(ctx, s));
+	if (**s == '$' || **s == '\\' || **s == '`')
+	{
+		(*s)++;
+		return (heredoc_put(ctx, *s - 1, 1));
+	}
+	return (heredoc_put(ctx, "\\", 1));
+}
+
+/**
+ * @brief Expands a heredoc line and appends it, with its newline.
+ *
+ * Text between `$` and `\` is appended in runs.
+ *
+ * @param ctx Heredoc context.
+ * @param line The line read; restored before returning.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
+ */
+int	expand_heredoc_line(t_heredoc_ctx *ctx, char *line)
+{
+	size_t	run;
+
+	while (*line)
+	{
+		run = 0;
+		while (line[run] && line[run] != '$' && line[run] != '\\')
+			run++;
+		if (heredoc_put(ctx, line, run) == WRITE_HERED_ERR)
+			return (WRITE_HERED_ERR);
+		line += run;
+		if (*line && put_special(ctx, &line) == WRITE_HERED_ERR)
+			return (WRITE_HERED_ERR);
+	}
+	return (heredoc_put(ctx, "\n", 1));
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_file.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file heredoc_file.c
+ * @brief Anonymous files for heredoc bodies that outgrow their pipe.
+ *
+ * The body is read before its command starts, so a pipe can only hold as
+ * much as its buffer. Larger bodies continue in an unlinked file, which
+ * is sealed and rewound before it becomes the command's stdin; its size
+ * is limited only by memory (or the temporary directory).
+ */
+#include "minishell.h"
+#ifdef __linux__
+# include <sys/mman.h>
+
+/**
+ * @brief Creates an anonymous, close-on-exec read-write file.
+ *
+ * Uses `memfd_create()`, or an `O_TMPFILE` file in /tmp where memfds are
+ * not available.
+ *
+ * @return The file descriptor, or -1 with `errno` set.
+ */
+int	open_heredoc_file(void)
+{
+	int	fd;
+
+	fd = memfd_create("minishell-heredoc", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	if (fd == -1)
+		fd = open("/tmp", O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	return (fd);
+}
+
+/**
+ * @brief Freezes a heredoc file and rewinds it for reading.
+ *
+ * A memfd is sealed against any further change; an `O_TMPFILE` file
+ * cannot be sealed and is only rewound.
+ *
+ * @param fd The heredoc file.
+ * @return 0 on success, -1 with `errno` set.
+ */
+int	seal_heredoc_file(int fd)
+{
+	if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE
+			| F_SEAL_SEAL) == -1 && errno != EINVAL)
+		return (-1);
+	if (lseek(fd, 0, SEEK_SET) == -1)
+		return (-1);
+	return (0);
+}
+
+#else
+
+/**
+ * @brief Creates an unlinked, close-on-exec temporary file in /tmp.
+ *
+ * @return The file descriptor, or -1 with `errno` set.
+ */
+int	open_heredoc_file(void)
+{
+	char	path[32];
+	int		fd;
+
+	ft_strlcpy(path, "/tmp/minishell-heredoc.XXXXXX", sizeof(path));
+	fd = mkstemp(path);
+	if (fd == -1)
+		return (-1);
+	unlink(path);
+	if (fcntl(fd, F_SETFD, FD_CLOEXEC) == -1)
+		return (close(fd), -1);
+	return (fd);
+}
+
+/**
+ * @brief Rewinds a heredoc file for reading.
+ *
+ * @param fd The heredoc file.
+ * @return 0 on success, -1 with `errno` set.
+ */
+int	seal_heredoc_file(int fd)
+{
+	if (lseek(fd, 0, SEEK_SET) == -1)
+		return (-1);
+	return (0);
+}
+
+#endif
@@ -12,95 +12,74 @@
 
 /**
  * @file write_heredoc_to_pipe.c
- * @brief Functions for collecting heredoc input and writing it into a pipe.
+ * @brief Reading a heredoc body into the heredoc buffer.
  */
 #include "minishell.h"
 
-static int	handle_heredoc_status(int status)
+static int	process_heredoc_line(t_heredoc_ctx *ctx, char **line)
 {
-	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGINT)
-	{
-		g_signal_flag = 1;
-		return (HEREDOC_INTERRUPTED);
-	}
-	if (WIFEXITED(status))
-	{
-		if (WEXITSTATUS(status) == HEREDOC_INTERRUPTED)
-		{
-			g_signal_flag = 1;
-			return (HEREDOC_INTERRUPTED);
-		}
-		if (WEXITSTATUS(status) == WRITE_HERED_ERR)
-		{
-			return (WRITE_HERED_ERR);
-		}
-		if (WEXITSTATUS(status) == EXIT_SUCCESS)
-		{
-			return (EXIT_SUCCESS);
-		}
-	}
+	int	status;
+
+	if (!read_next_heredoc_line(line, ctx->delim) || g_signal_flag)
+		return (1);
+	if (ctx->discard)
+		status = EXIT_SUCCESS;
+	else if (ctx->expand)
+		status = expand_heredoc_line(ctx, *line);
+	else
+		status = write_heredoc_line(ctx, *line);
+	free_ptr((void **)line);
+	if (status == WRITE_HERED_ERR)
+		return (WRITE_HERED_ERR);
 	return (EXIT_SUCCESS);
 }
 
 /**
- * @brief Reads user input and writes heredoc content to a pipe.
+ * @brief Reads heredoc lines up to the delimiter into the buffer.
  *
- * Loops over input lines using readline(), checking against the given
- * delimiter. Writes each line into the write-end of the pipe, with
- * a newline. Prevents overly large input using heredoc size limits.
- *
- * @param pipe_fd The write-end of the pipe.
- * @param delim The heredoc delimiter.
- * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
- * 		return (WRITE_HERED_ERR);
-	return (EXIT_SUCCESS);
-
+ * @param ctx Heredoc context.
+ * @return EXIT_SUCCESS, WRITE_HERED_ERR on error, or HEREDOC_INTERRUPTED
+ *         after SIGINT.
  */
-static int	get_expand_flag(t_cmd *cmd, const char *delim)
+static int	read_heredoc_body(t_heredoc_ctx *ctx)
 {
-	t_redir	*redir;
+	char	*line;
+	int		status;
 
-	redir = find_redir_by_delim(cmd->redirs, delim);
-	if (redir)
-		return (redir->expand_in_heredoc);
-	print_error("Internal error: heredoc delimiter not found.\n");
-	return (0);
-}
-
-static int	heredoc_parent_process(pid_t pid, int pipe_fd,
-	t_mshell **ms)
-{
-	int	status;
-
-	signal(SIGINT, SIG_IGN);
-	signal(SIGQUIT, SIG_IGN);
-	safe_close(&pipe_fd);
-	free_minishell(ms);
-	waitpid(pid, &status, 0);
-	signal(SIGINT, handle_sigint);
-	signal(SIGQUIT, handle_sigquit);
-	return (handle_heredoc_status(status));
+	line = NULL;
+	status = EXIT_SUCCESS;
+	while (!g_signal_flag)
+	{
+		status = process_heredoc_line(ctx, &line);
+		if (status != 0)
+			break ;
+	}
+	if (line)
+		free(line);
+	if (g_signal_flag)
+		return (HEREDOC_INTERRUPTED);
+	if (status == WRITE_HERED_ERR)
+		return (WRITE_HERED_ERR);
+	return (EXIT_SUCCESS);
 }
 
-int	write_heredoc_to_pipe(t_cmd *cmd, int pipe_fd, const char *delim)
+/**
+ * @brief Reads a heredoc body in the shell.
+ *
+ * SIGINT is reported through `g_signal_flag`. Lines collect in
+ * `ctx->buf` and reach the heredoc file in large `writev()`s once the
+ * body outgrows it (see `heredoc_put()`); `finish_heredoc()` then picks
+ * a pipe or the file.
+ *
+ * @param ctx Heredoc context.
+ * @return EXIT_SUCCESS, WRITE_HERED_ERR on error, or HEREDOC_INTERRUPTED.
+ */
+int	write_heredoc_to_pipe(t_heredoc_ctx *ctx)
 {
-	pid_t	pid;
-	int		ret;
-	int		expand_flag;
-	t_cmd	*head;
+	int	ret;
 
-	expand_flag = get_expand_flag(cmd, delim);
-	head = get_cmd_head(cmd);
-	pid = fork();
-	if (pid == -1)
-		return (perror_return("fork", WRITE_HERED_ERR));
-	if (pid == 0)
-	{
-		ret = run_heredoc_child(pipe_fd, delim, cmd->minishell, expand_flag);
-		safe_close(&pipe_fd);
-		free_minishell(&cmd->minishell);
-		free_cmd(&head);
-		_exit(ret);
-	}
-	return (heredoc_parent_process(pid, pipe_fd, &cmd->minishell));
+	setup_heredoc_signals();
+	ret = read_heredoc_body(ctx);
+	restore_heredoc_signals();
+	return (ret);
 }
@@ -10,89 +10,57 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+/**
+ * @file write_heredoc_utils.c
+ * @brief Signal handling while the shell reads a heredoc body.
+ */
 #include "minishell.h"
 
 /**
- * @brief Handles SIGINT in heredoc (child process).
+ * @brief Handles SIGINT while a heredoc body is read.
+ *
+ * Installed without SA_RESTART, so a pending `read()` fails with EINTR;
+ * readline is stopped by `heredoc_event_hook()`.
  */
 void	heredoc_sigint_handler(int sig)
 {
 	(void)sig;
 	g_signal_flag = 1;
-	close(STDIN_FILENO);
 }
 
-static int	handle_expanded_line(int pipe_fd, char *line, t_mshell *mshell)
+/**
+ * @brief Readline event hook that ends the current heredoc line on SIGINT.
+ *
+ * @return Always 0.
+ */
+static int	heredoc_event_hook(void)
 {
-	char	*expanded_line;
-	int		status;
-
-	expanded_line = expand_env_variables(line, mshell, 0);
-	if (!expanded_line)
-	{
-		perror_return("heredoc expansion failed", WRITE_HERED_ERR);
-		expanded_line = line;
-	}
-	else
-		free(line);
-	status = write_heredoc_line(pipe_fd, expanded_line);
-	free(expanded_line);
-	if (status == WRITE_HERED_ERR)
-		return (WRITE_HERED_ERR);
-	return (EXIT_SUCCESS);
+	if (g_signal_flag)
+		rl_done = 1;
+	return (0);
 }
 
-static int	process_heredoc_line(t_heredoc_ctx *ctx, char **line)
+/**
+ * @brief Sets up SIGINT handling for reading a heredoc in the shell.
+ */
+void	setup_heredoc_signals(void)
 {
-	int	status;
+	struct sigaction	sa;
 
-	if (!read_next_heredoc_line(line, ctx->delim))
-		return (1);
-	*ctx->total += ft_strlen(*line) + 1;
-	if (heredoc_exceeds_limit(*ctx->total))
-	{
-		free(*line);
-		return (error_return("heredoc: large input\n", WRITE_HERED_ERR));
-	}
-	if (ctx->expand)
-		status = handle_expanded_line(ctx->pipe_fd, *line, ctx->mshell);
-	else
-	{
-		status = write_heredoc_line(ctx->pipe_fd, *line);
-		free(*line);
-	}
-	*line = NULL;
-	if (status == WRITE_HERED_ERR)
-		return (WRITE_HERED_ERR);
-	return (EXIT_SUCCESS);
+	ft_memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = heredoc_sigint_handler;
+	sa.sa_flags = 0;
+	sigemptyset(&sa.sa_mask);
+	if (sigaction(SIGINT, &sa, NULL) == -1)
+		perror("sigaction(SIGINT) error in heredoc");
+	rl_event_hook = heredoc_event_hook;
 }
 
 /**
- * @brief Child: Reads user input and writes heredoc content to pipe.
+ * @brief Restores the prompt's SIGINT handling after a heredoc.
  */
-int	run_heredoc_child(int pipe_fd, const char *delim, t_mshell *mshell,
-	int expand_flag)
+void	restore_heredoc_signals(void)
 {
-	t_heredoc_ctx	ctx;
-	char			*line;
-	size_t			total;
-	int				status;
-
-	setup_heredoc_signals();
-	disable_echoctl();
-	total = 0;
-	line = NULL;
-	status = EXIT_SUCCESS;
-	ctx = (t_heredoc_ctx){pipe_fd, delim, mshell, expand_flag, &total};
-	while (!g_signal_flag)
-	{
-		status = process_heredoc_line(&ctx, &line);
-		if (status != 0)
-			break ;
-	}
-	if (line)
-		free(line);
-	if (g_signal_flag)
-		return (HEREDOC_INTERRUPTED);
-	return (status);
+	rl_event_hook = NULL;
+	signal(SIGINT, handle_sigint);
 }
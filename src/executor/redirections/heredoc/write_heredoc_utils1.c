@@ -13,88 +13,118 @@
 #include "minishell.h"
 
 /**
- * @brief Searches for a heredoc redirection by its delimiter.
+ * @brief Writes a whole iovec array, resuming after partial writes.
  *
- * Iterates through a linked list of redirection structures (`t_redir`)
- * and returns the one matching the given heredoc delimiter.
+ * On failure `iov` describes what is left to write.
  *
- * @param redirs A pointer to the head of the redirection list (`t_list` 
- * of `t_redir`).
- * @param delim The delimiter string to match against the heredoc's filename.
- * @return A pointer to the matching `t_redir` if found; otherwise, NULL.
+ * @param fd Destination.
+ * @param iov Buffers to write; updated as they are written.
+ * @param cnt Number of buffers.
+ * @return 0 on success, -1 with `errno` set (EAGAIN on a full pipe).
  */
-t_redir	*find_redir_by_delim(t_list *redirs, const char *delim)
+int	heredoc_writev(int fd, struct iovec *iov, int cnt)
 {
-	t_list	*node;
-	t_redir	*redir;
+	ssize_t	written;
 
-	node = redirs;
-	while (node)
+	while (cnt > 0)
 	{
-		redir = (t_redir *)node->content;
-		if (redir->type == R_HEREDOC && redir->filename && delim
-			&& ft_strcmp(redir->filename, delim) == 0)
+		written = writev(fd, iov, cnt);
+		if (written == -1 && errno == EINTR)
+			continue ;
+		if (written == -1)
+			return (-1);
+		while (cnt > 0 && (size_t)written >= iov->iov_len)
 		{
-			return (redir);
+			written -= iov->iov_len;
+			iov++;
+			cnt--;
+		}
+		if (cnt > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + written;
+			iov->iov_len -= written;
 		}
-		node = node->next;
 	}
-	return (NULL);
+	return (0);
 }
 
 /**
- * @brief Writes a single line to the heredoc pipe with a trailing newline.
+ * @brief Appends bytes to the heredoc body.
  *
- * This function appends a newline character after writing the given line
- * and handles any `write()` errors.
+ * Bytes collect in `ctx->buf`. When they do not fit, the body has
+ * outgrown a pipe: the buffer and the new bytes go to the heredoc file
+ * in one `writev()`.
  *
- * @param pipe_fd Write end of the pipe.
- * @param line The line to write.
- * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on failure.
+ * @param ctx Heredoc context.
+ * @param s Bytes to append.
+ * @param n Number of bytes.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on error.
  */
-int	write_heredoc_line(int pipe_fd, const char *line)
+int	heredoc_put(t_heredoc_ctx *ctx, const char *s, size_t n)
 {
-	if (write(pipe_fd, line, ft_strlen(line)) == -1 || write(pipe_fd, "\n",
-			1) == -1)
+	struct iovec	iov[2];
+
+	if (ctx->len + n <= HEREDOC_BUF_SIZE)
 	{
-		return (perror_return("write_heredoc_line: write", WRITE_HERED_ERR));
+		ft_memcpy(ctx->buf + ctx->len, s, n);
+		ctx->len += n;
+		return (EXIT_SUCCESS);
 	}
+	if (ctx->file_fd == -1)
+		ctx->file_fd = open_heredoc_file();
+	if (ctx->file_fd == -1)
+		return (perror_return("heredoc: file", WRITE_HERED_ERR));
+	iov[0].iov_base = ctx->buf;
+	iov[0].iov_len = ctx->len;
+	iov[1].iov_base = (void *)s;
+	iov[1].iov_len = n;
+	if (heredoc_writev(ctx->file_fd, iov, 2) == -1)
+		return (perror_return("heredoc: write", WRITE_HERED_ERR));
+	ctx->len = 0;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Appends a single line and its newline to the heredoc body.
+ *
+ * @param ctx Heredoc context.
+ * @param line The line to write.
+ * @return EXIT_SUCCESS on success, WRITE_HERED_ERR on failure.
+ */
+int	write_heredoc_line(t_heredoc_ctx *ctx, const char *line)
+{
+	if (heredoc_put(ctx, line, ft_strlen(line)) == WRITE_HERED_ERR
+		|| heredoc_put(ctx, "\n", 1) == WRITE_HERED_ERR)
+		return (WRITE_HERED_ERR);
 	return (EXIT_SUCCESS);
 }
 
+/**
+ * @brief Reads the next line of a heredoc body.
+ *
+ * Without a terminal the line comes from `get_next_line()`; its newline
+ * is cut off in place rather than by copying the line again.
+ *
+ * @param line Receives the line (heap-allocated), or NULL at the end.
+ * @param delimiter Line that ends the body.
+ * @return 1 if `line` holds a body line, 0 at the delimiter or EOF.
+ */
 int	read_next_heredoc_line(char **line, const char *delimiter)
 {
-	char	*line2;
+	size_t	len;
 
 	if (isatty(STDIN_FILENO))
 		*line = readline("> ");
 	else
 	{
-		line2 = get_next_line(STDIN_FILENO);
-		if (!line2)
-			return (free_ptr((void **)line), 0);
-		*line = ft_strtrim(line2, "\n");
-		free(line2);
+		*line = get_next_line(STDIN_FILENO);
 		if (!*line)
 			return (0);
+		len = ft_strlen(*line);
+		if (len > 0 && (*line)[len - 1] == '\n')
+			(*line)[len - 1] = '\0';
 	}
 	if (!*line || ft_strcmp(*line, delimiter) == 0)
 		return (free_ptr((void **)line), 0);
 	return (1);
 }
-
-/**
- * @brief Setup signal handlers inside heredoc child process.
- */
-void	setup_heredoc_signals(void)
-{
-	struct sigaction	sa;
-
-	ft_memset(&sa, 0, sizeof(sa));
-	sa.sa_handler = heredoc_sigint_handler;
-	sa.sa_flags = 0;
-	sigemptyset(&sa.sa_mask);
-	if (sigaction(SIGINT, &sa, NULL) == -1)
-		perror("sigaction(SIGINT) error in heredoc child");
-	signal(SIGQUIT, SIG_IGN);
-}
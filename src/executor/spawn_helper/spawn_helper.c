@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_helper.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file spawn_helper.c
+ * @brief Starting commands through a small helper process.
+ *
+ * `fork()` copies the page tables of the whole shell, which keeps
+ * growing with history and variables. With `MINISHELL_SPAWN_HELPER` set
+ * when the shell starts, `init_mshell()` forks a helper while the shell
+ * is still small. Plain external pipeline stages, with or without
+ * redirections, are then sent to it over a socket and it starts them
+ * from its own address space. It clones them with `CLONE_PARENT`, so
+ * they are children of the shell, which waits for them and controls
+ * them as jobs exactly as before. Whatever the helper cannot start
+ * takes the usual fork path; systems other than Linux always do (see
+ * spawn_helper_stub.c).
+ */
+#include "minishell.h"
+#ifdef __linux__
+# include <sys/socket.h>
+
+/**
+ * @brief Starts the spawn helper if `MINISHELL_SPAWN_HELPER` is set.
+ *
+ * Without a helper `t_mshell->spawn_fd` stays -1 and every stage is
+ * started by the shell itself.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ */
+void	start_spawn_helper(t_mshell *mshell)
+{
+	int		sv[2];
+	pid_t	pid;
+
+	if (!getenv("MINISHELL_SPAWN_HELPER")
+		|| socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == -1)
+		return ;
+	pid = fork();
+	if (pid == -1)
+	{
+		close(sv[0]);
+		close(sv[1]);
+		return ;
+	}
+	if (pid == 0)
+	{
+		close(sv[0]);
+		spawn_helper_main(sv[1]);
+	}
+	close(sv[1]);
+	mshell->spawn_fd = sv[0];
+}
+
+/**
+ * @brief Lets the helper go; it exits once its socket is closed.
+ */
+void	stop_spawn_helper(t_mshell *mshell)
+{
+	safe_close(&mshell->spawn_fd);
+}
+
+/**
+ * @brief Sends a request with its fds, then its strings.
+ *
+ * @return true if everything was sent.
+ */
+static bool	send_req(int sock, t_spawn_req *req, int *fds, const char *buf)
+{
+	struct msghdr	msg;
+	struct iovec	iov;
+	size_t			ctrl[SPAWN_CTRL_WORDS];
+	struct cmsghdr	*cmsg;
+
+	ft_memset(&msg, 0, sizeof(msg));
+	iov.iov_base = req;
+	iov.iov_len = sizeof(*req);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctrl;
+	msg.msg_controllen = CMSG_SPACE(sizeof(int) * req->nfds);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int) * req->nfds);
+	ft_memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * req->nfds);
+	if (sendmsg(sock, &msg, MSG_NOSIGNAL) != (ssize_t)sizeof(*req))
+		return (false);
+	return (send_full(sock, buf, req->len));
+}
+
+/**
+ * @brief Sends one request and reads the helper's answer.
+ *
+ * A helper that cannot be talked to any more is let go, so the shell
+ * does not try it again.
+ *
+ * @return The answer; `pid` is -1 if nothing was started.
+ */
+static t_spawn_reply	ask_helper(t_mshell *mshell, t_spawn_req *req,
+	int *fds, const char *buf)
+{
+	t_spawn_reply	reply;
+
+	reply.pid = -1;
+	reply.err = EPROTO;
+	if (!send_req(mshell->spawn_fd, req, fds, buf)
+		|| !read_full(mshell->spawn_fd, &reply, sizeof(reply)))
+	{
+		stop_spawn_helper(mshell);
+		reply.pid = -1;
+	}
+	return (reply);
+}
+
+/**
+ * @brief Starts a pipeline stage through the spawn helper.
+ *
+ * A stage whose `execve()` failed is reaped at once and left to the
+ * fork path, whose child reports the error as usual.
+ *
+ * @param cmd The command of the stage, binary already resolved.
+ * @param info Pointer to the pipeline information structure.
+ * @return true if the stage runs, false to start it another way.
+ */
+bool	helper_spawn(t_cmd *cmd, t_pipe_info *info)
+{
+	t_spawn_req		req;
+	t_spawn_reply	reply;
+	int				fds[SPAWN_MAX_FDS];
+	char			*buf;
+
+	buf = pack_spawn_req(cmd, info, &req, fds);
+	if (!buf)
+		return (false);
+	reply = ask_helper(cmd->minishell, &req, fds, buf);
+	close(fds[3]);
+	free(buf);
+	if (reply.pid > 0 && reply.err != 0)
+		waitpid(reply.pid, NULL, 0);
+	if (reply.pid <= 0 || reply.err != 0)
+		return (false);
+	track_stage(info, reply.pid);
+	return (true);
+}
+
+#endif
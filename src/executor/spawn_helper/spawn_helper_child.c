@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_helper_child.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file spawn_helper_child.c
+ * @brief A stage started by the spawn helper, up to its `execve()`.
+ */
+#include "minishell.h"
+#ifdef __linux__
+
+/**
+ * @brief Resets signals like `setup_child_signals()` does for a forked
+ *        stage, and clears the signal mask.
+ */
+static void	child_signals(int flags)
+{
+	sigset_t	none;
+
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	if (flags & SPAWN_BG_CHILD)
+	{
+		signal(SIGINT, SIG_IGN);
+		signal(SIGQUIT, SIG_IGN);
+	}
+	signal(SIGPIPE, SIG_DFL);
+	signal(SIGTSTP, SIG_DFL);
+	signal(SIGTTIN, SIG_DFL);
+	signal(SIGTTOU, SIG_DFL);
+	sigemptyset(&none);
+	sigprocmask(SIG_SETMASK, &none, NULL);
+}
+
+/**
+ * @brief Installs the passed stdin, stdout and stderr and moves to the
+ *        shell's working directory.
+ *
+ * @return false on failure, with `errno` set.
+ */
+static bool	child_fds(t_spawn_ctx *ctx)
+{
+	int	fd;
+
+	fd = 0;
+	while (fd < 3)
+	{
+		if (dup2(ctx->fds[fd], fd) == -1)
+			return (false);
+		fd++;
+	}
+	return (fchdir(ctx->fds[3]) == 0);
+}
+
+/**
+ * @brief Sets the stage up and execs it; never returns.
+ *
+ * The process group and terminal are taken first, while the signals
+ * ignored by the helper are still ignored. A failed redirection is
+ * reported here and ends the stage with status 1, as in a forked stage.
+ * Other failures are sent to the helper through `err_fd`, so that the
+ * shell starts the stage itself instead.
+ *
+ * @param ctx The unpacked request.
+ * @param err_fd Close-on-exec pipe back to the helper.
+ */
+void	spawn_helper_child(t_spawn_ctx *ctx, int err_fd)
+{
+	t_cmd	cmd;
+	int		err;
+
+	if (ctx->req.flags & SPAWN_JOB_CONTROL)
+	{
+		setpgid(0, ctx->req.pgid);
+		if (ctx->req.flags & SPAWN_FOREGROUND)
+			tcsetpgrp(STDIN_FILENO, getpgrp());
+	}
+	child_signals(ctx->req.flags);
+	if (child_fds(ctx))
+	{
+		ft_memset(&cmd, 0, sizeof(cmd));
+		if (ctx->req.nredir > 0)
+			cmd.redirs = ctx->nodes;
+		if (apply_redirections(&cmd) != EXIT_SUCCESS)
+			_exit(EXIT_FAILURE);
+		execve(ctx->binary, ctx->argv, ctx->envp);
+	}
+	err = errno;
+	write(err_fd, &err, sizeof(err));
+	_exit(127);
+}
+
+#endif
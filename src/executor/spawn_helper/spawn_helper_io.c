@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_helper_io.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file spawn_helper_io.c
+ * @brief Whole-message reads and writes on the spawn helper socket.
+ */
+#include "minishell.h"
+#ifdef __linux__
+# include <sys/socket.h>
+
+/**
+ * @brief Reads exactly `len` bytes.
+ *
+ * @return false on error or if the other side went away first.
+ */
+bool	read_full(int fd, void *buf, size_t len)
+{
+	size_t	done;
+	ssize_t	n;
+
+	done = 0;
+	while (done < len)
+	{
+		n = read(fd, (char *)buf + done, len - done);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (false);
+		done += n;
+	}
+	return (true);
+}
+
+/**
+ * @brief Sends exactly `len` bytes, without SIGPIPE if the other side
+ *        went away.
+ *
+ * @return false on error.
+ */
+bool	send_full(int sock, const void *buf, size_t len)
+{
+	size_t	done;
+	ssize_t	n;
+
+	done = 0;
+	while (done < len)
+	{
+		n = send(sock, (const char *)buf + done, len - done, MSG_NOSIGNAL);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (false);
+		done += n;
+	}
+	return (true);
+}
+
+#endif
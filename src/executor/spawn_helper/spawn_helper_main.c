@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_helper_main.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file spawn_helper_main.c
+ * @brief The spawn helper process: reads requests, starts stages.
+ */
+#include "minishell.h"
+#ifdef __linux__
+# include <sys/socket.h>
+# include <sys/syscall.h>
+# include <sched.h>
+
+/**
+ * @brief Receives a request header and the fds passed with it.
+ *
+ * @return false once the shell has closed its end.
+ */
+static bool	recv_header(int sock, t_spawn_ctx *ctx)
+{
+	struct msghdr	msg;
+	struct iovec	iov;
+	size_t			ctrl[SPAWN_CTRL_WORDS];
+	struct cmsghdr	*cmsg;
+	ssize_t			n;
+
+	ft_memset(&msg, 0, sizeof(msg));
+	iov.iov_base = &ctx->req;
+	iov.iov_len = sizeof(ctx->req);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctrl;
+	msg.msg_controllen = sizeof(ctrl);
+	n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	if (n > 0 && cmsg && cmsg->cmsg_level == SOL_SOCKET
+		&& cmsg->cmsg_type == SCM_RIGHTS
+		&& cmsg->cmsg_len <= CMSG_LEN(sizeof(ctx->fds)))
+		ft_memcpy(ctx->fds, CMSG_DATA(cmsg), cmsg->cmsg_len - CMSG_LEN(0));
+	if (n <= 0)
+		return (false);
+	return ((size_t)n == sizeof(ctx->req)
+		|| read_full(sock, (char *)&ctx->req + n, sizeof(ctx->req) - n));
+}
+
+/**
+ * @brief Closes the passed fds and frees everything a request holds.
+ */
+static void	free_ctx(t_spawn_ctx *ctx)
+{
+	int	i;
+
+	i = 0;
+	while (i < SPAWN_MAX_FDS)
+		safe_close(&ctx->fds[i++]);
+	free_ptr((void **)&ctx->buf);
+	free_ptr((void **)&ctx->argv);
+	free_ptr((void **)&ctx->envp);
+	free_ptr((void **)&ctx->redirs);
+	free_ptr((void **)&ctx->nodes);
+}
+
+/**
+ * @brief Receives a whole request.
+ *
+ * @return false once the shell has closed its end, or on error.
+ */
+static bool	recv_req(int sock, t_spawn_ctx *ctx)
+{
+	ft_memset(ctx, 0, sizeof(*ctx));
+	ft_memset(ctx->fds, -1, sizeof(ctx->fds));
+	if (!recv_header(sock, ctx) || ctx->req.len == 0)
+		return (free_ctx(ctx), false);
+	ctx->buf = malloc(ctx->req.len);
+	if (!ctx->buf || !read_full(sock, ctx->buf, ctx->req.len))
+		return (free_ctx(ctx), false);
+	return (true);
+}
+
+/**
+ * @brief Starts the stage of a request as a child of the shell.
+ *
+ * `CLONE_PARENT` makes the new process a sibling of the helper. The
+ * helper learns whether `execve()` worked from a close-on-exec pipe: it
+ * is closed without data on success, or carries `errno` on failure.
+ */
+static t_spawn_reply	run_req(t_spawn_ctx *ctx)
+{
+	t_spawn_reply	reply;
+	int				err_pipe[2];
+
+	reply.pid = -1;
+	reply.err = 0;
+	if (pipe2(err_pipe, O_CLOEXEC) == -1)
+		return (reply.err = errno, reply);
+	reply.pid = syscall(SYS_clone, CLONE_PARENT | SIGCHLD, 0, NULL, NULL, 0);
+	if (reply.pid == 0)
+		spawn_helper_child(ctx, err_pipe[1]);
+	if (reply.pid == -1)
+		reply.err = errno;
+	close(err_pipe[1]);
+	if (reply.pid > 0 && !read_full(err_pipe[0], &reply.err, sizeof(int)))
+		reply.err = 0;
+	close(err_pipe[0]);
+	return (reply);
+}
+
+/**
+ * @brief Body of the spawn helper; never returns.
+ *
+ * The helper stays in the shell's process group, so it ignores the
+ * terminal's signals, and it answers one request at a time until the
+ * shell closes the socket.
+ *
+ * @param sock The helper's end of the socket.
+ */
+void	spawn_helper_main(int sock)
+{
+	t_spawn_ctx		ctx;
+	t_spawn_reply	reply;
+
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	signal(SIGTSTP, SIG_IGN);
+	signal(SIGTTIN, SIG_IGN);
+	signal(SIGTTOU, SIG_IGN);
+	signal(SIGPIPE, SIG_IGN);
+	while (recv_req(sock, &ctx))
+	{
+		reply.pid = -1;
+		reply.err = EPROTO;
+		if (unpack_spawn_req(&ctx))
+			reply = run_req(&ctx);
+		free_ctx(&ctx);
+		if (!send_full(sock, &reply, sizeof(reply)))
+			break ;
+	}
+	close(sock);
+	_exit(EXIT_SUCCESS);
+}
+
+#endif
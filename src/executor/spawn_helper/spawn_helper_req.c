@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_helper_req.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file spawn_helper_req.c
+ * @brief Packing a pipeline stage into a spawn helper request.
+ */
+#include "minishell.h"
+#ifdef __linux__
+
+/**
+ * @brief Copies NULL-terminated strings one after another, or only
+ *        measures them if `dst` is NULL.
+ *
+ * @param count Receives the number of strings.
+ * @return The number of bytes, terminators included.
+ */
+static size_t	put_strs(char *dst, char **strs, int *count)
+{
+	size_t	len;
+	size_t	n;
+
+	len = 0;
+	*count = 0;
+	while (strs && strs[*count])
+	{
+		n = ft_strlen(strs[*count]) + 1;
+		if (dst)
+			ft_memcpy(dst + len, strs[*count], n);
+		len += n;
+		(*count)++;
+	}
+	return (len);
+}
+
+/**
+ * @brief Counts the redirections of a stage and collects its heredoc fds.
+ *
+ * A heredoc whose input was interrupted has no fd and, as in
+ * `handle_heredoc_redirection()`, no effect, so it is left out.
+ *
+ * @return false if the stage has more heredocs than one request carries.
+ */
+static bool	count_redirs(t_list *node, t_spawn_req *req, int *fds)
+{
+	t_redir	*r;
+
+	while (node)
+	{
+		r = node->content;
+		if (r->type == R_HEREDOC && r->fd >= 0)
+		{
+			if (req->nfds == SPAWN_MAX_FDS)
+				return (false);
+			fds[req->nfds++] = r->fd;
+			req->len += 2;
+			req->nredir++;
+		}
+		else if (r->type != R_HEREDOC)
+		{
+			req->len += ft_strlen(r->filename) + 2;
+			req->nredir++;
+		}
+		node = node->next;
+	}
+	return (true);
+}
+
+/**
+ * @brief Writes the redirections counted by `count_redirs()`.
+ */
+static void	put_redirs(char *dst, t_list *node)
+{
+	t_redir		*r;
+	const char	*name;
+	size_t		n;
+
+	while (node)
+	{
+		r = node->content;
+		if (r->type != R_HEREDOC || r->fd >= 0)
+		{
+			*dst++ = (char)r->type;
+			name = "";
+			if (r->type != R_HEREDOC)
+				name = r->filename;
+			n = ft_strlen(name) + 1;
+			ft_memcpy(dst, name, n);
+			dst += n;
+		}
+		node = node->next;
+	}
+}
+
+/**
+ * @brief Fills in everything but the strings: the stage's stdin, stdout
+ *        and stderr, its process group and how it treats signals.
+ */
+static void	init_req(t_cmd *cmd, t_pipe_info *info, t_spawn_req *req,
+	int *fds)
+{
+	ft_memset(req, 0, sizeof(*req));
+	fds[0] = info->in_fd;
+	fds[1] = STDOUT_FILENO;
+	if (info->pipe_fd[1] != -1)
+		fds[1] = info->pipe_fd[1];
+	fds[2] = STDERR_FILENO;
+	fds[3] = -1;
+	req->nfds = 4;
+	req->pgid = info->pgid;
+	if (cmd->minishell->job_control)
+		req->flags |= SPAWN_JOB_CONTROL;
+	if (!info->background)
+		req->flags |= SPAWN_FOREGROUND;
+	else if (!cmd->minishell->job_control)
+		req->flags |= SPAWN_BG_CHILD;
+}
+
+/**
+ * @brief Builds the request for a stage (see `t_spawn_req`).
+ *
+ * `fds[3]` is opened here on the working directory; the caller closes
+ * it once the request is sent.
+ *
+ * @param cmd The command of the stage, binary already resolved.
+ * @param info Pipeline information of the current stage.
+ * @param req Receives the request header.
+ * @param fds Receives the fds to pass along.
+ * @return The strings of the request, or NULL if it cannot be made.
+ */
+char	*pack_spawn_req(t_cmd *cmd, t_pipe_info *info, t_spawn_req *req,
+	int *fds)
+{
+	size_t	bin_len;
+	size_t	pos;
+	char	*buf;
+
+	init_req(cmd, info, req, fds);
+	bin_len = ft_strlen(cmd->binary) + 1;
+	req->len = bin_len + put_strs(NULL, cmd->argv, &req->argc)
+		+ put_strs(NULL, cmd->minishell->env, &req->envc);
+	if (!count_redirs(cmd->redirs, req, fds))
+		return (NULL);
+	fds[3] = open(".", O_PATH | O_DIRECTORY | O_CLOEXEC);
+	buf = NULL;
+	if (fds[3] != -1)
+		buf = malloc(req->len);
+	if (!buf)
+		return (safe_close(&fds[3]), NULL);
+	ft_memcpy(buf, cmd->binary, bin_len);
+	pos = bin_len + put_strs(buf + bin_len, cmd->argv, &req->argc);
+	pos += put_strs(buf + pos, cmd->minishell->env, &req->envc);
+	put_redirs(buf + pos, cmd->redirs);
+	return (buf);
+}
+
+#endif
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_helper_stub.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file spawn_helper_stub.c
+ * @brief Spawn helper for systems without `CLONE_PARENT`.
+ *
+ * The helper's stages must be children of the shell, which only Linux
+ * can arrange, so elsewhere there is no helper and every stage is
+ * started by the shell itself.
+ */
+#include "minishell.h"
+#ifndef __linux__
+
+/**
+ * @brief Does nothing: `t_mshell->spawn_fd` stays -1.
+ */
+void	start_spawn_helper(t_mshell *mshell)
+{
+	(void)mshell;
+}
+
+/**
+ * @brief Does nothing; there is no helper to stop.
+ */
+void	stop_spawn_helper(t_mshell *mshell)
+{
+	(void)mshell;
+}
+
+/**
+ * @brief Always fails; never reached since there is no helper.
+ */
+bool	helper_spawn(t_cmd *cmd, t_pipe_info *info)
+{
+	(void)cmd;
+	(void)info;
+	return (false);
+}
+
+#endif
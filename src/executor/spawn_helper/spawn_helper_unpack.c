@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_helper_unpack.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file spawn_helper_unpack.c
+ * @brief Unpacking a spawn helper request in the helper.
+ */
+#include "minishell.h"
+#ifdef __linux__
+
+/**
+ * @brief Returns the string at `*pos` and moves past it.
+ *
+ * @return The string, or NULL if it runs past the end of the request.
+ */
+static char	*next_str(t_spawn_ctx *ctx, size_t *pos)
+{
+	char	*str;
+	char	*end;
+
+	if (*pos >= ctx->req.len)
+		return (NULL);
+	str = ctx->buf + *pos;
+	end = ft_memchr(str, '\0', ctx->req.len - *pos);
+	if (!end)
+		return (NULL);
+	*pos += end - str + 1;
+	return (str);
+}
+
+/**
+ * @brief Fills `dst` with the next `count` strings of the request.
+ *
+ * @return false if the request ends early.
+ */
+static bool	next_strs(t_spawn_ctx *ctx, size_t *pos, char **dst, int count)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+	{
+		dst[i] = next_str(ctx, pos);
+		if (!dst[i])
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Reads the next redirection; a heredoc takes the next passed fd.
+ *
+ * @return false if the request is malformed.
+ */
+static bool	next_redir(t_spawn_ctx *ctx, size_t *pos, t_redir *r, int *fd_i)
+{
+	if (*pos >= ctx->req.len)
+		return (false);
+	r->type = (t_redir_type)ctx->buf[(*pos)++];
+	r->filename = next_str(ctx, pos);
+	r->fd = -1;
+	if (r->type == R_HEREDOC && *fd_i < ctx->req.nfds)
+		r->fd = ctx->fds[(*fd_i)++];
+	return (r->filename && (r->type != R_HEREDOC || r->fd != -1));
+}
+
+/**
+ * @brief Rebuilds the redirection list `apply_redirections()` walks.
+ *
+ * Heredocs take the passed fds that follow the working directory.
+ *
+ * @return false if the request is malformed.
+ */
+static bool	unpack_redirs(t_spawn_ctx *ctx, size_t pos)
+{
+	int	i;
+	int	fd_i;
+
+	ctx->redirs = ft_calloc(ctx->req.nredir, sizeof(t_redir));
+	ctx->nodes = ft_calloc(ctx->req.nredir, sizeof(t_list));
+	if (!ctx->redirs || !ctx->nodes)
+		return (false);
+	fd_i = 4;
+	i = 0;
+	while (i < ctx->req.nredir)
+	{
+		if (!next_redir(ctx, &pos, &ctx->redirs[i], &fd_i))
+			return (false);
+		ctx->nodes[i].content = &ctx->redirs[i];
+		if (i + 1 < ctx->req.nredir)
+			ctx->nodes[i].next = &ctx->nodes[i + 1];
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Turns a received request into the binary, argument, environment
+ *        and redirection lists of the stage.
+ *
+ * @param ctx The request; the lists are freed with it.
+ * @return false if the request is malformed.
+ */
+bool	unpack_spawn_req(t_spawn_ctx *ctx)
+{
+	size_t	pos;
+
+	if (ctx->req.argc < 1 || ctx->req.envc < 0 || ctx->req.nredir < 0
+		|| ctx->req.nfds < 4 || ctx->req.nfds > SPAWN_MAX_FDS
+		|| ctx->fds[ctx->req.nfds - 1] < 0)
+		return (false);
+	ctx->argv = ft_calloc(ctx->req.argc + 1, sizeof(char *));
+	ctx->envp = ft_calloc(ctx->req.envc + 1, sizeof(char *));
+	if (!ctx->argv || !ctx->envp)
+		return (false);
+	pos = 0;
+	ctx->binary = next_str(ctx, &pos);
+	if (!ctx->binary || !next_strs(ctx, &pos, ctx->argv, ctx->req.argc)
+		|| !next_strs(ctx, &pos, ctx->envp, ctx->req.envc))
+		return (false);
+	if (ctx->req.nredir == 0)
+		return (true);
+	return (unpack_redirs(ctx, pos));
+}
+
+#endif
@@ -23,6 +23,9 @@ int	main(int argc, char **argv, char **envp)
 	minishell = init_mshell(envp);
 	if (!minishell)
 		return (EXIT_FAILURE);
+	if (is_input_interactive())
+		setup_completion(minishell);
+	setup_job_control(minishell);
 	if (BIGTEST == 1 && !is_input_interactive())
 		exit_status = run_non_interactive_mode(minishell);
 	else
@@ -67,6 +67,7 @@ uint8_t	run_interactive_mode(t_mshell *mshell)
 	{
 		if (handle_signal_interrupt(mshell))
 			continue ;
+		reap_jobs(mshell);
 		input = read_user_input();
 		if (handle_signal_interrupt(mshell))
 			continue ;
@@ -20,6 +20,7 @@ static uint8_t	run_command_mode(t_mshell *mshell, char *input)
 	cmd = run_parser(mshell, input);
 	if (!cmd)
 		return (EXIT_FAILURE);
+	mshell->exec_last = true;
 	exit_status = run_executor(cmd);
 	free_cmd(&cmd);
 	return (exit_status);
@@ -25,7 +25,7 @@ static int	open_script_file(const char *file)
 {
 	int	fd;
 
-	fd = open(file, O_RDONLY);
+	fd = open(file, O_RDONLY | O_CLOEXEC);
 	if (fd < 0)
 	{
 		print_error("-minishell: cannot open script file: ");
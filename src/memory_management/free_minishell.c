@@ -37,7 +37,7 @@ void	free_env(char ***env_ptr)
 /**
  * @brief Frees a single `t_mshell_var` variable structure.
  *
- * Frees both the key and value strings and the structure itself.
+ * Frees the `KEY=VALUE` buffer and the structure itself.
  *
  * @param var The environment variable structure to free.
  */
@@ -45,41 +45,34 @@ void	free_mshell_var(t_mshell_var *var)
 {
 	if (!var)
 		return ;
-	if (var->key)
-		free(var->key);
-	if (var->value)
-		free(var->value);
+	free(var->key);
 	free(var);
 }
 
 /**
  * @brief Frees all memory used by the shell’s hash table.
  *
- * Iterates over each bucket in the hash table and frees all
- * linked environment variable structures.
+ * Iterates over the hash table, frees every environment variable
+ * structure, then the slot array, the ordered index and the table itself.
  *
  * @param hash_table Pointer to the hash table to free.
  */
 void	free_hash_table(t_hash_tbl *hash_table)
 {
-	int				i;
-	t_mshell_var	*current;
-	t_mshell_var	*temp;
+	size_t			pos;
+	t_mshell_var	*var;
 
 	if (!hash_table)
 		return ;
-	i = 0;
-	while (i < HASH_SIZE)
+	pos = 0;
+	var = ht_iter_next(hash_table, &pos);
+	while (var)
 	{
-		current = hash_table->buckets[i];
-		while (current)
-		{
-			temp = current;
-			current = current->next;
-			free_mshell_var(temp);
-		}
-		i++;
+		free_mshell_var(var);
+		var = ht_iter_next(hash_table, &pos);
 	}
+	free(hash_table->slots);
+	free(hash_table->order);
 	free(hash_table);
 }
 
@@ -87,8 +80,12 @@ void	free_hash_table(t_hash_tbl *hash_table)
  * @brief Frees the entire `t_mshell` structure and its resources.
  *
  * This includes:
- * - The environment variable array (`env`)
+ * - The environment variable array (`env`) and its owner table; the
+ *   strings it lists belong to the variables in the hash table
+ * - The `PATH` directory cache, its open directory fds, its miss cache
+ *   and index, and the command table
  * - The hash table (`hash_table`)
+ * - The socket to the spawn helper, which then exits
  * - The structure itself
  *
  * @param minishell The Minishell structure to free.
@@ -100,11 +97,16 @@ void	free_minishell(t_mshell **minishell_ptr)
 	if (!minishell_ptr || !*minishell_ptr)
 		return ;
 	minishell = *minishell_ptr;
-	if (minishell->env)
-	{
-		free_env(&minishell->env);
-		minishell->env = NULL;
-	}
+	free_ptr((void **)&minishell->env);
+	free_ptr((void **)&minishell->env_vars);
+	close_path_dirs(&minishell->path_cache);
+	miss_cache_clear(&minishell->path_cache);
+	path_index_free(&minishell->path_cache.index);
+	free_ptr((void **)&minishell->path_cache.dirs);
+	cmd_table_free(&minishell->cmd_table);
+	free_ptr((void **)&minishell->pipestatus);
+	jobs_free(&minishell->jobs);
+	stop_spawn_helper(minishell);
 	if (minishell->hash_table)
 	{
 		free_hash_table(minishell->hash_table);
@@ -35,18 +35,3 @@ void	free_str_array_range(char **arr, size_t count)
 		i++;
 	}
 }
-
-/**
- * @brief Frees a t_mshell_var and sets its pointer to NULL.
- *
- * @param pair Double pointer to the variable structure.
- */
-void	free_pair(t_mshell_var **pair)
-{
-	if (!pair || !*pair)
-		return ;
-	free((*pair)->key);
-	free((*pair)->value);
-	free(*pair);
-	*pair = NULL;
-}
@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file cmd_table.c
+ * @brief Lookup and insertion for the command table.
+ *
+ * The command table remembers where a name was found in `PATH`, so the
+ * next use of the same name costs one lookup here instead of a `PATH`
+ * walk. Each entry owns a single buffer: the absolute path, whose last
+ * component is the command name.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Finds the slot holding `name`, or the free slot ending its probe.
+ *
+ * @param ct Pointer to the command table (with slots allocated).
+ * @param name Command name.
+ * @param hash Hash of `name`.
+ * @param len Length of `name`.
+ * @return Index of the matching slot, or of the first free slot.
+ */
+static size_t	ct_find_slot(t_cmd_tbl *ct, const char *name,
+		unsigned int hash, size_t len)
+{
+	size_t		mask;
+	size_t		i;
+	t_cmd_entry	*slot;
+
+	mask = ct->cap - 1;
+	i = hash & mask;
+	slot = &ct->slots[i];
+	while (slot->path)
+	{
+		if (slot->hash == hash && slot->name_len == len
+			&& ft_memcmp(slot->name, name, len) == 0)
+			return (i);
+		i = (i + 1) & mask;
+		slot = &ct->slots[i];
+	}
+	return (i);
+}
+
+/**
+ * @brief Looks up a command by name.
+ *
+ * @param ct Pointer to the command table.
+ * @param name Command name.
+ * @return The entry, or NULL if `name` is not remembered.
+ */
+t_cmd_entry	*cmd_table_get(t_cmd_tbl *ct, const char *name)
+{
+	size_t		i;
+	size_t		unused;
+
+	if (!ct || !name || ct->count == 0)
+		return (NULL);
+	i = ct_find_slot(ct, name, hash_function(name, &unused),
+			ft_strlen(name));
+	if (!ct->slots[i].path)
+		return (NULL);
+	return (&ct->slots[i]);
+}
+
+/**
+ * @brief Puts an entry into the first free slot of its probe run.
+ *
+ * @param slots Slot array with at least one free slot.
+ * @param cap Number of slots (a power of two).
+ * @param entry Entry to place.
+ */
+static void	ct_place(t_cmd_entry *slots, size_t cap, t_cmd_entry *entry)
+{
+	size_t	i;
+
+	i = entry->hash & (cap - 1);
+	while (slots[i].path)
+		i = (i + 1) & (cap - 1);
+	slots[i] = *entry;
+}
+
+/**
+ * @brief Allocates the slots on first use, or doubles them.
+ *
+ * Stored hashes are reused, so no name is hashed again.
+ *
+ * @param ct Pointer to the command table.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+static int	ct_grow(t_cmd_tbl *ct)
+{
+	t_cmd_entry	*new_slots;
+	size_t		new_cap;
+	size_t		i;
+
+	new_cap = CMD_TBL_MIN_CAP;
+	if (ct->cap)
+		new_cap = ct->cap * 2;
+	new_slots = ft_calloc(new_cap, sizeof(t_cmd_entry));
+	if (!new_slots)
+		return (error_return("cmd_table: malloc failed\n", EXIT_FAILURE));
+	i = 0;
+	while (i < ct->cap)
+	{
+		if (ct->slots[i].path)
+			ct_place(new_slots, new_cap, &ct->slots[i]);
+		i++;
+	}
+	free(ct->slots);
+	ct->slots = new_slots;
+	ct->cap = new_cap;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Remembers an absolute path under its last component.
+ *
+ * An existing entry for the same name is replaced. The new entry starts
+ * with one hit, the use that resolved it.
+ *
+ * @param ct Pointer to the command table.
+ * @param path Absolute path of the command; copied.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+int	cmd_table_insert(t_cmd_tbl *ct, const char *path)
+{
+	t_cmd_entry	entry;
+	size_t		unused;
+	size_t		i;
+
+	if ((ct->count + 1) * 4 > ct->cap * 3 && ct_grow(ct) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	entry.path = ft_strdup(path);
+	if (!entry.path)
+		return (error_return("cmd_table: malloc failed\n", EXIT_FAILURE));
+	entry.name = ft_strrchr(entry.path, '/') + 1;
+	entry.name_len = ft_strlen(entry.name);
+	entry.hash = hash_function(entry.name, &unused);
+	entry.hits = 1;
+	i = ct_find_slot(ct, entry.name, entry.hash, entry.name_len);
+	if (ct->slots[i].path)
+		free(ct->slots[i].path);
+	else
+		ct->count++;
+	ct->slots[i] = entry;
+	return (EXIT_SUCCESS);
+}
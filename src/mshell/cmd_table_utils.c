@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_table_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file cmd_table_utils.c
+ * @brief Removal and cleanup for the command table.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Closes the hole left at `hole` by a removed entry.
+ *
+ * Same backward shift as the variable table: later entries of the probe
+ * run move back when the hole lies between their home slot and their
+ * current position.
+ *
+ * @param ct Pointer to the command table.
+ * @param hole Index of the slot that was just freed.
+ */
+static void	ct_close_hole(t_cmd_tbl *ct, size_t hole)
+{
+	size_t	mask;
+	size_t	i;
+	size_t	home;
+
+	mask = ct->cap - 1;
+	i = (hole + 1) & mask;
+	while (ct->slots[i].path)
+	{
+		home = ct->slots[i].hash & mask;
+		if (((i - home) & mask) >= ((i - hole) & mask))
+		{
+			ct->slots[hole] = ct->slots[i];
+			hole = i;
+		}
+		i = (i + 1) & mask;
+	}
+	ft_memset(&ct->slots[hole], 0, sizeof(t_cmd_entry));
+}
+
+/**
+ * @brief Forgets a remembered command.
+ *
+ * @param ct Pointer to the command table.
+ * @param name Command name.
+ * @return `true` if `name` was remembered, `false` otherwise.
+ */
+bool	cmd_table_remove(t_cmd_tbl *ct, const char *name)
+{
+	t_cmd_entry	*entry;
+
+	entry = cmd_table_get(ct, name);
+	if (!entry)
+		return (false);
+	free(entry->path);
+	ct_close_hole(ct, entry - ct->slots);
+	ct->count--;
+	return (true);
+}
+
+/**
+ * @brief Forgets every remembered command, keeping the slots allocated.
+ *
+ * The hit and miss counters are kept.
+ *
+ * @param ct Pointer to the command table.
+ */
+void	cmd_table_clear(t_cmd_tbl *ct)
+{
+	size_t	i;
+
+	if (!ct || ct->count == 0)
+		return ;
+	i = 0;
+	while (i < ct->cap)
+	{
+		free(ct->slots[i].path);
+		i++;
+	}
+	ft_memset(ct->slots, 0, ct->cap * sizeof(t_cmd_entry));
+	ct->count = 0;
+}
+
+/**
+ * @brief Frees the command table's entries and slots.
+ *
+ * @param ct Pointer to the command table.
+ */
+void	cmd_table_free(t_cmd_tbl *ct)
+{
+	cmd_table_clear(ct);
+	free_ptr((void **)&ct->slots);
+	ct->cap = 0;
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_completion.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file command_completion.c
+ * @brief Readline completion of command names.
+ *
+ * The first word of a command (at the start of the line or after a `|`)
+ * completes from the built-ins and the `PATH` index; every other word
+ * keeps readline's file name completion.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Stores or returns the shell that completion works for.
+ *
+ * Readline callbacks take no user data, so the shell is kept here.
+ *
+ * @param mshell Shell to store, or NULL to only read it.
+ * @return The stored shell.
+ */
+static t_mshell	*completion_shell(t_mshell *mshell)
+{
+	static t_mshell	*saved;
+
+	if (mshell)
+		saved = mshell;
+	return (saved);
+}
+
+/**
+ * @brief Returns the next candidate name: built-ins first, then the
+ * names of the `PATH` index.
+ *
+ * @param idx `PATH` index, or NULL if it is not available.
+ * @param pos Iteration cursor, 0 for the first name.
+ * @return The next name, or NULL when done.
+ */
+static const char	*next_command_name(t_path_index *idx, size_t *pos)
+{
+	const t_builtin_disp	*table;
+	size_t					size;
+	t_pidx_slot				*slot;
+
+	table = get_builtin_table(&size);
+	if (*pos < size)
+		return (table[(*pos)++].name);
+	while (idx && *pos - size < idx->cap)
+	{
+		slot = &idx->slots[*pos - size];
+		(*pos)++;
+		if (slot->name_len)
+			return (idx->names + slot->name_off);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Readline generator for command names starting with `text`.
+ *
+ * @param text Word being completed.
+ * @param state 0 on the first call for a word.
+ * @return A heap-allocated match, or NULL when there are no more.
+ */
+static char	*command_generator(const char *text, int state)
+{
+	static size_t		pos;
+	static t_path_index	*idx;
+	t_path_cache		*pc;
+	const char			*name;
+
+	if (state == 0)
+	{
+		pos = 0;
+		idx = NULL;
+		pc = get_path_cache(completion_shell(NULL));
+		if (pc && path_index_ready(pc))
+			idx = &pc->index;
+	}
+	name = next_command_name(idx, &pos);
+	while (name && ft_strncmp(name, text, ft_strlen(text)) != 0)
+		name = next_command_name(idx, &pos);
+	if (!name)
+		return (NULL);
+	return (ft_strdup(name));
+}
+
+/**
+ * @brief Completes command names in command position.
+ *
+ * @param text Word being completed.
+ * @param start Offset of `text` in the line.
+ * @param end Offset of the cursor.
+ * @return Matches, or NULL to fall back to file name completion.
+ */
+static char	**complete_command(const char *text, int start, int end)
+{
+	int	i;
+
+	(void)end;
+	if (ft_strchr(text, '/'))
+		return (NULL);
+	i = start - 1;
+	while (i >= 0 && (rl_line_buffer[i] == ' ' || rl_line_buffer[i] == '\t'))
+		i--;
+	if (i >= 0 && rl_line_buffer[i] != '|')
+		return (NULL);
+	return (rl_completion_matches(text, command_generator));
+}
+
+/**
+ * @brief Turns on command completion and the `PATH` index.
+ *
+ * Called for interactive sessions only; scripts keep probing `PATH`
+ * directly and never pay for reading whole directories.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ */
+void	setup_completion(t_mshell *mshell)
+{
+	completion_shell(mshell);
+	mshell->path_cache.index.enabled = true;
+	rl_attempted_completion_function = complete_command;
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_cache.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_cache.c
+ * @brief Environment generations and caches of derived data.
+ *
+ * Every change to a variable bumps `mshell->env_gen` and stamps the
+ * variable with the new value. Code that derives data from a variable
+ * (a split `PATH`, a parsed `SHLVL`, ...) keeps a `t_var_cache` and only
+ * recomputes when `var_cache_changed()` says so.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Sets up the caches kept in the shell structure.
+ *
+ * The generation starts at 1, so a zeroed cache is always stale.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ */
+void	init_env_caches(t_mshell *mshell)
+{
+	mshell->env_gen = 1;
+	ft_memset(&mshell->home_cache, 0, sizeof(t_var_cache));
+	ft_memset(&mshell->shlvl_cache, 0, sizeof(t_var_cache));
+	ft_memset(&mshell->pipe_cache, 0, sizeof(t_var_cache));
+	ft_memset(&mshell->path_cache, 0, sizeof(t_path_cache));
+	mshell->home_cache.key = "HOME";
+	mshell->shlvl_cache.key = "SHLVL";
+	mshell->pipe_cache.key = "MINISHELL_PIPESIZE";
+	mshell->path_cache.var.key = "PATH";
+	mshell->path_cache.index.watch_fd = -1;
+}
+
+/**
+ * @brief Records a change to the environment.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ * @param var The variable that was set, or NULL if one was unset.
+ */
+void	mark_env_changed(t_mshell *mshell, t_mshell_var *var)
+{
+	mshell->env_gen++;
+	if (var)
+		var->gen = mshell->env_gen;
+}
+
+/**
+ * @brief Returns the generation of a single variable.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ * @param key Variable name.
+ * @return The variable's generation, or 0 if it is not set.
+ */
+unsigned long	ms_var_gen(t_mshell *mshell, const char *key)
+{
+	t_mshell_var	*var;
+
+	if (!mshell)
+		return (0);
+	var = ht_get(mshell->hash_table, key);
+	if (!var)
+		return (0);
+	return (var->gen);
+}
+
+/**
+ * @brief Revalidates a cache and tells whether its variable changed.
+ *
+ * If no variable changed since the last call this is a single integer
+ * compare. Otherwise the variable is looked up again and `cache->value`
+ * is refreshed.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ * @param cache Cache to revalidate.
+ * @return `true` on the first call and whenever the variable has been
+ * set or unset since the previous call, `false` otherwise.
+ */
+bool	var_cache_changed(t_mshell *mshell, t_var_cache *cache)
+{
+	t_mshell_var	*var;
+	unsigned long	var_gen;
+	bool			changed;
+
+	if (cache->env_gen == mshell->env_gen)
+		return (false);
+	var = ht_get(mshell->hash_table, cache->key);
+	var_gen = 0;
+	cache->value = NULL;
+	if (var)
+	{
+		var_gen = var->gen;
+		cache->value = var->value;
+	}
+	changed = (cache->env_gen == 0 || var_gen != cache->var_gen);
+	cache->env_gen = mshell->env_gen;
+	cache->var_gen = var_gen;
+	return (changed);
+}
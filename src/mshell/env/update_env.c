@@ -12,159 +12,149 @@
 
 /**
  * @file update_env.c
- * @brief Synchronizes environment variables from hash table to env array.
+ * @brief Keeps the `env` array in sync with the variable hash table.
  *
- * This file contains logic for updating the Minishell's `env` array
- * from its internal hash table representation. It only includes variables
- * marked as assigned (i.e., exported with a value).
+ * Instead of rebuilding the whole `env` array after every change, each
+ * variable remembers its slot (`env_idx`). Setting, assigning or unsetting
+ * a variable only rewrites, appends or removes that single slot, so the cost
+ * of a change does not depend on the size of the environment.
+ *
+ * The slots point straight at the variables' own `KEY=VALUE` buffers; the
+ * `env` array owns none of the strings it lists.
  */
 #include "minishell.h"
 
 /**
- * @brief Adds an assigned environment variable to the new environment array.
- *
- * Formats the variable into a `KEY=VALUE` string and stores it in `new_env`.
- * If memory allocation fails, the function returns `false`.
+ * @brief Doubles the capacity of the `env` array and its owner table.
  *
- * @param var Pointer to the environment variable structure.
- * @param new_env The array where the formatted entry will be stored.
- * @param idx Pointer to the current index in `new_env`.
- * @return `true` if the entry was added successfully, `false` on failure.
+ * @param mshell Pointer to the Minishell structure.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
  */
-bool	add_env_entry(t_mshell_var *var, char **new_env, int *idx)
+static int	grow_env_slots(t_mshell *mshell)
 {
-	char	*entry;
+	size_t			new_cap;
+	char			**new_env;
+	t_mshell_var	**new_vars;
 
-	if (!var || !new_env || !idx)
-		return (false);
-	entry = create_env_entry(var);
-	if (!entry)
-		return (false);
-	new_env[*idx] = entry;
-	(*idx)++;
-	return (true);
+	new_cap = mshell->env_cap * 2;
+	if (new_cap < ENV_MIN_CAP)
+		new_cap = ENV_MIN_CAP;
+	new_env = ft_realloc(mshell->env, sizeof(char *) * (mshell->env_cap + 1),
+			sizeof(char *) * (new_cap + 1));
+	if (!new_env)
+		return (error_return("grow_env_slots: malloc failed\n", EXIT_FAILURE));
+	mshell->env = new_env;
+	new_vars = ft_realloc(mshell->env_vars,
+			sizeof(t_mshell_var *) * mshell->env_cap,
+			sizeof(t_mshell_var *) * new_cap);
+	if (!new_vars)
+		return (error_return("grow_env_slots: malloc failed\n", EXIT_FAILURE));
+	mshell->env_vars = new_vars;
+	mshell->env_cap = new_cap;
+	return (EXIT_SUCCESS);
 }
 
 /**
- * @brief Processes a single bucket in the hash table and adds
- * entries to `new_env`.
- *
- * Iterates through all variables in a bucket and adds assigned variables
- * to `new_env` in the format `KEY=VALUE`.
+ * @brief Allocates an empty `env` array able to hold `cap` entries.
  *
- * @param bucket The linked list of environment variables in a bucket.
- * @param new_env The array where environment variables are stored.
- * @param idx Pointer to the current index in `new_env`.
- * @return `true` if all entries were added successfully, `false`
- * if a failure occurred.
+ * @param mshell Pointer to the Minishell structure.
+ * @param cap Expected number of exported variables.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
  */
-bool	process_env_bucket(t_mshell_var *bucket, char **new_env, int *idx)
+int	init_env_slots(t_mshell *mshell, size_t cap)
 {
-	t_mshell_var	*current;
-
-	if (!new_env || !idx)
-		return (false);
-	current = bucket;
-	while (current)
+	mshell->env = NULL;
+	mshell->env_vars = NULL;
+	mshell->env_count = 0;
+	mshell->env_cap = 0;
+	if (cap < ENV_MIN_CAP)
+		cap = ENV_MIN_CAP;
+	mshell->env = malloc(sizeof(char *) * (cap + 1));
+	mshell->env_vars = malloc(sizeof(t_mshell_var *) * cap);
+	if (!mshell->env || !mshell->env_vars)
 	{
-		if (current->val_assigned)
-		{
-			if (!add_env_entry(current, new_env, idx))
-				return (false);
-		}
-		current = current->next;
+		free_ptr((void **)&mshell->env);
+		free_ptr((void **)&mshell->env_vars);
+		return (error_return("init_env_slots: malloc failed\n", EXIT_FAILURE));
 	}
-	return (true);
+	mshell->env[0] = NULL;
+	mshell->env_cap = cap;
+	return (EXIT_SUCCESS);
 }
 
 /**
- * @brief Populates the new environment array with assigned variables.
+ * @brief Removes a variable's entry from the `env` array.
  *
- * Iterates through the hash table, extracts assigned variables, and
- * formats them into `KEY=VALUE` strings, storing them in `new_env`.
+ * The last slot is moved into the freed one, so removal is O(1).
+ * Does nothing if the variable is not exported.
  *
- * @param mshell Pointer to the Minishell structure containing the hash table.
- * @param new_env The newly allocated array for storing environment variables.
- * @return `true` if successful, `false` if a memory allocation fails.
+ * @param mshell Pointer to the Minishell structure.
+ * @param var The variable leaving the environment.
  */
-static bool	populate_env_array(t_mshell *mshell, char **new_env)
+void	drop_env_slot(t_mshell *mshell, t_mshell_var *var)
 {
-	int	i;
-	int	idx;
+	size_t	last;
+	size_t	idx;
 
-	if (!mshell || !mshell->hash_table || !new_env)
-		return (false);
-	i = 0;
-	idx = 0;
-	while (i < HASH_SIZE)
+	if (!mshell || !var || var->env_idx < 0 || mshell->env_count == 0)
+		return ;
+	idx = (size_t)var->env_idx;
+	last = mshell->env_count - 1;
+	if (idx != last)
 	{
-		if (!process_env_bucket(mshell->hash_table->buckets[i], new_env, &idx))
-		{
-			free_partial_env(new_env, idx);
-			return (false);
-		}
-		i++;
+		mshell->env[idx] = mshell->env[last];
+		mshell->env_vars[idx] = mshell->env_vars[last];
+		mshell->env_vars[idx]->env_idx = (int)idx;
 	}
-	new_env[idx] = NULL;
-	return (true);
+	mshell->env[last] = NULL;
+	mshell->env_count = last;
+	var->env_idx = -1;
 }
 
 /**
- * @brief Counts the number of exported environment variables.
+ * @brief Appends a variable's entry to the end of the `env` array.
  *
- * Iterates through the hash table to count variables marked as assigned.
- *
- * @param ht Pointer to the hash table containing environment variables.
- * @return The number of exported environment variables.
+ * @param mshell Pointer to the Minishell structure.
+ * @param var The variable to export.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
  */
-static int	count_exported_vars(t_hash_tbl *ht)
+static int	append_env_slot(t_mshell *mshell, t_mshell_var *var)
 {
-	int				i;
-	int				count;
-	t_mshell_var	*curr;
-
-	count = 0;
-	i = 0;
-	while (i < HASH_SIZE)
-	{
-		curr = ht->buckets[i];
-		while (curr)
-		{
-			if (curr->val_assigned)
-				count++;
-			curr = curr->next;
-		}
-		i++;
-	}
-	return (count);
+	if (mshell->env_count == mshell->env_cap
+		&& grow_env_slots(mshell) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	var->env_idx = (int)mshell->env_count;
+	mshell->env[mshell->env_count] = var->key;
+	mshell->env_vars[mshell->env_count] = var;
+	mshell->env_count++;
+	mshell->env[mshell->env_count] = NULL;
+	return (EXIT_SUCCESS);
 }
 
 /**
- * @brief Updates the environment variable array.
+ * @brief Brings the `env` slot of a single variable up to date.
  *
- * Allocates a new environment array, populates it with assigned variables
- * from the hash table, and replaces the old environment array.
+ * - Assigned variables get their slot pointed at their current
+ *   `KEY=VALUE` buffer, or appended if they were not exported yet.
+ * - Unassigned variables are removed from the array.
  *
  * @param mshell Pointer to the Minishell structure.
+ * @param var The variable that has just been created or modified.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
  */
-int	update_env(t_mshell *mshell)
+int	sync_env_slot(t_mshell *mshell, t_mshell_var *var)
 {
-	int		count;
-	char	**new_env;
-	bool	populated;
-
-	count = count_exported_vars(mshell->hash_table);
-	new_env = malloc(sizeof(char *) * (count + 1));
-	if (!new_env)
-	{
-		print_error("-minishell: update_env: malloc failed\n");
+	if (!mshell || !var)
 		return (EXIT_FAILURE);
+	if (!var->val_assigned)
+	{
+		drop_env_slot(mshell, var);
+		return (EXIT_SUCCESS);
 	}
-	ft_memset(new_env, 0, sizeof(char *) * (count + 1));
-	populated = populate_env_array(mshell, new_env);
-	if (populated == false)
-		return (EXIT_FAILURE);
-	free_env(&mshell->env);
-	mshell->env = new_env;
-	return (EXIT_SUCCESS);
+	if (var->env_idx >= 0)
+	{
+		mshell->env[var->env_idx] = var->key;
+		return (EXIT_SUCCESS);
+	}
+	return (append_env_slot(mshell, var));
 }
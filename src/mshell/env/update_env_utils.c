@@ -15,7 +15,7 @@
  * @brief Utility functions for creating and freeing environment variables.
  *
  * This file provides helper functions used when managing environment variables
- * in Minishell, including creation of `KEY=VALUE` formatted strings
+ * in Minishell, including the `KEY=VALUE` buffer each variable lives in
  * and cleanup of dynamically allocated environment arrays.
  */
 #include "minishell.h"
@@ -44,39 +44,58 @@ void	free_partial_env(char **env, int count)
 }
 
 /**
- * @brief Creates a formatted environment entry string.
+ * @brief Returns the length of a variable name ending at `\0` or `=`.
  *
- * Constructs a new string in the format `KEY=VALUE` using the key and value
- * from the provided environment variable structure.
+ * @param key Variable name, possibly followed by `=VALUE`.
+ * @return Number of characters in the name.
+ */
+static size_t	var_name_len(const char *key)
+{
+	size_t	len;
+
+	len = 0;
+	while (key[len] && key[len] != '=')
+		len++;
+	return (len);
+}
+
+/**
+ * @brief Stores a variable's name and value in one `KEY=VALUE` buffer.
+ *
+ * The new buffer replaces the old one, which is freed only after copying,
+ * so `key` and `value` may point into it. Without a value the buffer holds
+ * just the name.
  *
- * @param var Pointer to the `t_mshell_var` structure containing key-value data.
- * @return A newly allocated string containing `KEY=VALUE`, or NULL on failure.
+ * @param var Pointer to the variable to update.
+ * @param key Variable name, terminated by `\0` or `=`.
+ * @param value New value, or NULL if no value is assigned.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
  */
-char	*create_env_entry(t_mshell_var *mshell_var)
+int	set_var_entry(t_mshell_var *var, const char *key, const char *value)
 {
-	size_t	total_len;
 	char	*entry;
-	char	*val;
-	int		len_key;
-	int		len_val;
+	size_t	key_len;
+	size_t	val_size;
 
-	if (!mshell_var || !mshell_var->key)
-		return (NULL);
-	if (mshell_var->value)
-		val = mshell_var->value;
-	else
-		val = "";
-	len_key = ft_strlen(mshell_var->key);
-	len_val = ft_strlen(val);
-	total_len = len_key + len_val + 2;
-	entry = malloc(total_len * sizeof(char));
+	key_len = var_name_len(key);
+	val_size = 0;
+	if (value)
+		val_size = ft_strlen(value) + 1;
+	entry = malloc(key_len + val_size + 1);
 	if (!entry)
+		return (print_error("-minishell: set_var_entry, malloc failed\n"),
+			EXIT_FAILURE);
+	ft_memcpy(entry, key, key_len);
+	entry[key_len] = '\0';
+	var->value = NULL;
+	if (value)
 	{
-		print_error("-minishell: create_env_entry, malloc failed\n");
-		return (NULL);
+		entry[key_len] = '=';
+		ft_memcpy(entry + key_len + 1, value, val_size);
+		var->value = entry + key_len + 1;
 	}
-	ft_strlcpy(entry, mshell_var->key, total_len);
-	ft_strlcat(entry, "=", total_len);
-	ft_strlcat(entry, val, total_len);
-	return (entry);
+	free(var->key);
+	var->key = entry;
+	var->key_len = key_len;
+	return (EXIT_SUCCESS);
 }
@@ -17,7 +17,8 @@
  * This file contains logic for resolving a command's executable binary path.
  * It supports:
  * - Absolute or relative paths (`/usr/bin/ls`, `./script.sh`)
- * - Searching through `$PATH` directories for the binary name
+ * - Searching through the cached `$PATH` directories for the binary name,
+ *   remembering the result in the command table
  * - Falling back when `$PATH` is unset or empty
  * - Returning `NULL` for built-in commands
  */
@@ -40,37 +41,84 @@ static char	*handle_direct_path(t_cmd *cmd)
 	return (binary);
 }
 
+/**
+ * @brief Looks the command up in the command table.
+ *
+ * A remembered path is re-checked with a single `access()`; if it is no
+ * longer executable the entry is dropped and counted as a miss, so the
+ * caller falls back to a `PATH` search.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return Heap-allocated copy of the remembered path, or `NULL`.
+ */
+static char	*handle_hashed_command(t_cmd *cmd)
+{
+	t_cmd_tbl	*ct;
+	t_cmd_entry	*entry;
+	char		*binary;
+
+	ct = &cmd->minishell->cmd_table;
+	entry = cmd_table_get(ct, cmd->argv[0]);
+	if (!entry || access(entry->path, X_OK) != 0)
+	{
+		if (entry)
+			cmd_table_remove(ct, cmd->argv[0]);
+		ct->misses++;
+		return (NULL);
+	}
+	binary = ft_strdup(entry->path);
+	if (!binary)
+		return (NULL);
+	entry->hits++;
+	ct->hits++;
+	cmd->minishell->exit_status = EXIT_SUCCESS;
+	return (binary);
+}
+
 /**
  * @brief Searches for the binary in the directories listed in the
  * `PATH` variable.
  *
- * - Splits the `PATH` environment variable by `:` and searches each directory.
- * - Returns the full path to the binary if found.
- * - If `PATH` is not set or memory allocation fails, sets exit status to 127.
+ * - Answers from the command table when the name was seen before.
+ * - Otherwise walks the cached `PATH` split (see `get_path_cache()`)
+ *   and remembers the result if it is an absolute path. Names that
+ *   contain a `/` are never remembered.
+ * - Interactive shells consult the `PATH` index first: it tells at once
+ *   whether any directory holds the name, and where to start probing.
+ * - Otherwise, names found in no directory at all go to the miss cache,
+ *   so repeating them does not walk `PATH` again until a directory
+ *   changes.
+ * - If nothing is found, sets exit status to 127 (or 126).
  *
  * @param cmd Pointer to the command structure.
+ * @param pc Up-to-date path cache.
  * @return Full path to binary on success, or `NULL` if not found.
  */
-static char	*handle_path_search(t_cmd *cmd)
+static char	*handle_path_search(t_cmd *cmd, t_path_cache *pc)
 {
-	char	*env;
-	char	**paths;
 	char	*binary;
+	bool	hashable;
+	size_t	start;
 
-	env = ms_getenv(cmd->minishell, "PATH");
-	if (!env || !*env)
+	hashable = (ft_strchr(cmd->argv[0], '/') == NULL);
+	start = 0;
+	if (hashable)
 	{
-		cmd->minishell->exit_status = 127;
-		return (NULL);
+		binary = handle_hashed_command(cmd);
+		if (binary)
+			return (binary);
+		start = path_search_start(pc, cmd->argv[0]);
 	}
-	paths = ft_split(env, ':');
-	if (!paths)
+	if (start >= pc->count)
 	{
 		cmd->minishell->exit_status = 127;
 		return (NULL);
 	}
-	binary = search_paths(paths, cmd);
-	ft_free_arrstrs(paths);
+	binary = search_paths(pc, cmd, start);
+	if (binary && hashable && binary[0] == '/')
+		cmd_table_insert(&cmd->minishell->cmd_table, binary);
+	else if (!binary && hashable && !pc->any_candidate)
+		miss_cache_add(pc, cmd->argv[0]);
 	return (binary);
 }
 
@@ -117,8 +165,7 @@ static char	*handle_missing_path(t_cmd *cmd)
  */
 char	*find_binary(t_cmd *cmd)
 {
-	char	*binary;
-	char	*path_env;
+	t_path_cache	*pc;
 
 	if (!cmd || !cmd->argv || !cmd->argv[0] || ft_strlen(cmd->argv[0]) == 0)
 	{
@@ -129,9 +176,13 @@ char	*find_binary(t_cmd *cmd)
 		return (NULL);
 	if (cmd->argv[0][0] == '/' || cmd->argv[0][0] == '.')
 		return (handle_direct_path(cmd));
-	path_env = ms_getenv(cmd->minishell, "PATH");
-	if (!path_env || path_env[0] == '\0')
+	pc = get_path_cache(cmd->minishell);
+	if (!pc)
+	{
+		cmd->minishell->exit_status = 127;
+		return (NULL);
+	}
+	if (!pc->var.value || pc->var.value[0] == '\0')
 		return (handle_missing_path(cmd));
-	binary = handle_path_search(cmd);
-	return (binary);
+	return (handle_path_search(cmd, pc));
 }
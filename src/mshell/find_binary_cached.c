@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   find_binary_cached.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file find_binary_cached.c
+ * @brief Resolves a command only from what the shell already knows.
+ *
+ * Used by the parent before it launches a pipeline stage itself (see
+ * spawn_child.c). Unlike `find_binary()` it never walks `PATH`: a name
+ * is answered from the command table or the `PATH` index, at the cost
+ * of one `access()`, or not at all. A stage that is not answered keeps
+ * the fork path, whose child resolves it as usual, so the parent never
+ * searches `PATH` for one stage after another.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Looks the name up in the command table.
+ *
+ * The table is only read: like a lookup made by a pipeline child, this
+ * does not count a hit nor drop a stale entry.
+ *
+ * @param cmd Pointer to the command structure.
+ * @return Heap-allocated copy of the remembered path, or `NULL`.
+ */
+static char	*cached_in_table(t_cmd *cmd)
+{
+	t_cmd_entry	*entry;
+
+	entry = cmd_table_get(&cmd->minishell->cmd_table, cmd->argv[0]);
+	if (!entry || access(entry->path, X_OK) != 0)
+		return (NULL);
+	return (ft_strdup(entry->path));
+}
+
+/**
+ * @brief Looks the name up in the `PATH` index.
+ *
+ * Only the first directory holding the name is tried. If that file is
+ * not executable, `search_paths()` would go on to later directories, so
+ * the name is left to it.
+ *
+ * @param cmd Pointer to the command structure.
+ * @param pc Up-to-date path cache.
+ * @return Heap-allocated path of the binary, or `NULL`.
+ */
+static char	*cached_in_index(t_cmd *cmd, t_path_cache *pc)
+{
+	t_pidx_slot	*slot;
+	t_path_dir	*dir;
+	char		buf[PATH_MAX];
+	size_t		name_len;
+
+	if (!path_index_ready(pc))
+		return (NULL);
+	slot = path_index_get(&pc->index, cmd->argv[0]);
+	if (!slot || slot->dir >= pc->count)
+		return (NULL);
+	dir = &pc->dirs[slot->dir];
+	name_len = ft_strlen(cmd->argv[0]);
+	if (dir->len + name_len + 2 > PATH_MAX)
+		return (NULL);
+	ft_memcpy(buf, dir->dir, dir->len);
+	buf[dir->len] = '/';
+	ft_memcpy(buf + dir->len + 1, cmd->argv[0], name_len + 1);
+	if (faccessat(AT_FDCWD, buf, X_OK, AT_EACCESS) != 0)
+		return (NULL);
+	return (ft_strdup(buf));
+}
+
+/**
+ * @brief Resolves a command without searching `PATH`.
+ *
+ * - Direct paths (`/bin/ls`, `./script.sh`) are taken as they are, as
+ *   `find_binary()` does.
+ * - Other names are answered from the command table, then from the
+ *   `PATH` index.
+ * - Anything else, including an unset or empty `PATH`, is a miss.
+ *
+ * Unlike `find_binary()`, a miss sets no exit status: the caller is
+ * expected to fall back to the full lookup.
+ *
+ * @param cmd Pointer to the command structure (not a builtin).
+ * @return Full path to the binary (heap-allocated) or `NULL` on a miss.
+ */
+char	*find_binary_cached(t_cmd *cmd)
+{
+	t_path_cache	*pc;
+	char			*binary;
+
+	if (!cmd || !cmd->argv || !cmd->argv[0] || !cmd->argv[0][0])
+		return (NULL);
+	if (cmd->argv[0][0] == '/' || cmd->argv[0][0] == '.')
+		return (ft_strdup(cmd->argv[0]));
+	if (ft_strchr(cmd->argv[0], '/'))
+		return (NULL);
+	pc = get_path_cache(cmd->minishell);
+	if (!pc || !pc->var.value || pc->var.value[0] == '\0')
+		return (NULL);
+	binary = cached_in_table(cmd);
+	if (!binary)
+		binary = cached_in_index(cmd, pc);
+	return (binary);
+}
@@ -15,119 +15,137 @@
  * @brief Resolves the path to a binary by searching directories from $PATH.
  *
  * This file contains helper functions for locating a binary executable
- * by scanning each directory in the `PATH` environment variable.
- * It constructs full paths, checks access permissions, and ensures proper
- * memory management.
+ * by scanning each directory of the cached `PATH` split. Absolute
+ * directories are probed through a directory fd kept open in the cache
+ * (see `path_dir_fd()`),
+ * so each candidate costs one `faccessat()` and no path walk from `/`.
+ * Relative directories are still resolved from the current directory.
+ * Only the path that is finally found is built and put on the heap.
  */
 #include "minishell.h"
 
 /**
- * @brief Joins a directory path with a command name using a `/` separator.
+ * @brief Joins a directory with a command name using a `/` separator.
  *
- * Combines the provided `path` (e.g., `/usr/bin`) and `cmd_name` (e.g., `ls`)
- * into a full path like `/usr/bin/ls`. Returns a newly allocated string.
+ * Writes e.g. `/usr/bin` + `ls` as `/usr/bin/ls` into `buf`.
  *
- * @param path Directory to prepend.
+ * @param buf Destination buffer of `PATH_MAX` bytes.
+ * @param dir `PATH` entry to prepend.
  * @param cmd_name Name of the command to append.
- * @return Heap-allocated full path string, or NULL on failure.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if the result does not fit.
  */
-static char	*join_path_with_command(const char *path, const char *cmd_name)
+static int	join_path_with_command(char *buf, const t_path_dir *dir,
+	const char *cmd_name)
 {
-	char	*temp;
-	char	*full_path;
+	size_t	name_len;
 
-	temp = ft_strjoin(path, "/");
-	if (!temp)
-	{
-		print_error("Error (assign_binary): ft_strjoin failed\n");
-		return (NULL);
-	}
-	full_path = ft_strjoin(temp, cmd_name);
-	free(temp);
-	if (!full_path)
-		print_error("Error (assign_binary): ft_strjoin failed\n");
-	return (full_path);
+	name_len = ft_strlen(cmd_name);
+	if (dir->len + name_len + 2 > PATH_MAX)
+		return (EXIT_FAILURE);
+	ft_memcpy(buf, dir->dir, dir->len);
+	buf[dir->len] = '/';
+	ft_memcpy(buf + dir->len + 1, cmd_name, name_len + 1);
+	return (EXIT_SUCCESS);
 }
 
 /**
  * @brief Checks whether the binary exists and is executable.
  *
- * Verifies that the binary path is valid and has execute permission.
+ * One `faccessat()` decides the common case; only when it fails for a
+ * reason other than `ENOENT` does `fstatat()` tell a missing file from
+ * one that is not executable.
  * Sets the appropriate `exit_status` in the command if the check fails:
  * - 127 if file not found.
  * - 126 if not executable.
  *
- * @param binary Full path to the binary.
+ * @param dirfd Directory to resolve `name` from, or `AT_FDCWD`.
+ * @param name Binary name (relative to `dirfd`).
  * @param cmd Command structure (used to set exit status).
  * @return `EXIT_SUCCESS` if accessible, `EXIT_FAILURE` otherwise.
  */
-static uint8_t	check_binary_access(char *binary, t_cmd *cmd)
+static uint8_t	check_binary_access(int dirfd, const char *name, t_cmd *cmd)
 {
-	if (access(binary, F_OK) != 0)
-	{
-		free(binary);
+	struct stat	st;
+
+	if (faccessat(dirfd, name, X_OK, AT_EACCESS) == 0)
+		return (EXIT_SUCCESS);
+	if (errno == ENOENT || fstatat(dirfd, name, &st, 0) != 0)
 		cmd->minishell->exit_status = 127;
-		return (EXIT_FAILURE);
-	}
-	if (access(binary, X_OK) != 0)
-	{
-		free(binary);
+	else
 		cmd->minishell->exit_status = 126;
-		return (EXIT_FAILURE);
-	}
-	return (EXIT_SUCCESS);
+	return (EXIT_FAILURE);
 }
 
 /**
- * @brief Creates the full binary path and checks its accessibility.
+ * @brief Checks one `PATH` directory for the command.
  *
- * - Calls `join_path_with_command()` to build full path.
- * - Uses `check_binary_access()` to validate existence and permissions.
- * - Frees the existing `cmd->binary` if already set.
+ * An absolute directory whose fd cannot be opened for lack of free
+ * descriptors is probed by full path instead.
  *
- * @param path A directory from the PATH array.
+ * @param buf Scratch buffer of `PATH_MAX` bytes; holds the full path
+ *            of the binary on success.
+ * @param dir A directory from the `PATH` cache.
  * @param cmd The command structure.
- * @return The valid full path to the binary, or NULL on failure.
+ * @return `EXIT_SUCCESS` if `buf` holds an executable path,
+ *         `EXIT_FAILURE` otherwise.
  */
-static char	*assign_binary(char *path, t_cmd *cmd)
+static int	try_path_dir(char *buf, t_path_dir *dir, t_cmd *cmd)
 {
-	char	*binary;
+	int	dirfd;
 
-	binary = join_path_with_command(path, cmd->argv[0]);
-	if (!binary)
+	cmd->minishell->exit_status = 127;
+	if (dir->dir[0] == '/')
 	{
-		cmd->minishell->exit_status = 127;
-		return (NULL);
+		dirfd = path_dir_fd(dir);
+		if (dirfd >= 0)
+		{
+			if (check_binary_access(dirfd, cmd->argv[0], cmd) != EXIT_SUCCESS)
+				return (EXIT_FAILURE);
+			return (join_path_with_command(buf, dir, cmd->argv[0]));
+		}
+		if (errno != EMFILE && errno != ENFILE)
+			return (EXIT_FAILURE);
 	}
-	if (check_binary_access(binary, cmd) != EXIT_SUCCESS)
-		return (NULL);
-	if (cmd->binary)
-		free(cmd->binary);
-	cmd->minishell->exit_status = EXIT_SUCCESS;
-	return (binary);
+	if (join_path_with_command(buf, dir, cmd->argv[0]) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	return (check_binary_access(AT_FDCWD, buf, cmd));
 }
 
 /**
- * @brief Searches for a binary in an array of PATH directories.
+ * @brief Searches for a binary in the cached `PATH` directories.
  *
- * Iterates over the `paths[]`, constructing and validating a full binary path
- * for each directory. Returns the first accessible binary path.
+ * Tries each directory in order and returns the first accessible binary.
+ * Frees the existing `cmd->binary` if one is found. On failure,
+ * `pc->any_candidate` tells whether some directory had a file of that
+ * name that was not executable.
  *
- * @param paths Array of directories to search (e.g., from `$PATH`).
+ * @param pc Up-to-date path cache (see `get_path_cache()`).
  * @param cmd Command structure.
- * @return Full binary path on success, or NULL if not found.
+ * @param start First directory to try; earlier ones are known not to
+ *              hold the command (see `path_search_start()`).
+ * @return Heap-allocated binary path on success, or NULL if not found.
  */
-char	*search_paths(char **paths, t_cmd *cmd)
+char	*search_paths(t_path_cache *pc, t_cmd *cmd, size_t start)
 {
-	int		i;
+	size_t	i;
+	char	buf[PATH_MAX];
 	char	*binary;
 
-	i = 0;
-	while (paths[i])
+	pc->any_candidate = false;
+	i = start;
+	while (i < pc->count)
 	{
-		binary = assign_binary(paths[i], cmd);
-		if (binary)
+		if (try_path_dir(buf, &pc->dirs[i], cmd) != EXIT_SUCCESS)
+			pc->any_candidate |= (cmd->minishell->exit_status == 126);
+		else
+		{
+			binary = ft_strdup(buf);
+			if (!binary)
+				return (cmd->minishell->exit_status = 127, NULL);
+			free(cmd->binary);
+			cmd->minishell->exit_status = EXIT_SUCCESS;
 			return (binary);
+		}
 		i++;
 	}
 	return (NULL);
@@ -39,43 +39,18 @@ static t_mshell	*allocate_minishell(void)
 		return (NULL);
 	}
 	ft_memset(mshell, 0, sizeof(t_mshell));
+	mshell->spawn_fd = -1;
 	return (mshell);
 }
 
-/**
- * @brief Initializes the environment variables.
- *
- * This function duplicates the provided environment (`envp`) array.
- * If `envp` is NULL or memory allocation fails during duplication, an error
- * is printed.
- *
- * @param envp The array of environment variables from the parent process.
- * @return A new environment array (heap-allocated), or NULL on failure.
- */
-static char	**init_env(char **envp)
-{
-	char	**env;
-
-	if (!envp)
-	{
-		print_error("-minishell: init_env, no environ found\n");
-		return (NULL);
-	}
-	env = setup_env(envp);
-	if (!env)
-	{
-		print_error("-minishell: init_env, setup environment failed\n");
-		return (NULL);
-	}
-	return (env);
-}
-
 /**
  * @brief Sets up the shell's environment and hash table.
  *
- * This function:
- * - Duplicates the system environment variables.
- * - Initializes the shell's hash table from the copied environment.
+ * This function reads the system environment in a single pass:
+ * - Sizes the shell's own `env` array and the hash table from the
+ *   number of entries in `envp`.
+ * - Inserts every entry into the hash table, which fills the `env`
+ *   array as variables are inserted.
  *
  * @param mshell Pointer to the `t_mshell` structure to initialize.
  * @param envp The environment array from the system.
@@ -83,14 +58,14 @@ static char	**init_env(char **envp)
  */
 static int	setup_environment(t_mshell *mshell, char **envp)
 {
-	mshell->env = init_env(envp);
-	if (!mshell->env)
-		return (EXIT_FAILURE);
-	if (setup_hash_table(mshell) == EXIT_FAILURE)
+	if (!envp)
 	{
+		print_error("-minishell: init_env, no environ found\n");
 		return (EXIT_FAILURE);
 	}
-	return (EXIT_SUCCESS);
+	if (init_env_slots(mshell, ft_arr_size(envp)) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	return (setup_hash_table(mshell, envp));
 }
 
 /**
@@ -98,8 +73,9 @@ static int	setup_environment(t_mshell *mshell, char **envp)
  *
  * This is the main initialization entry point for Minishell:
  * - Allocates the shell structure.
- * - Sets up environment variables and hash table.
+ * - Sets up the environment caches, environment variables and hash table.
  * - Initializes status values.
+ * - Starts the spawn helper if asked to, while the shell is still small.
  *
  * If any of the steps fail, all allocated memory is freed and NULL is returned.
  *
@@ -113,10 +89,12 @@ t_mshell	*init_mshell(char **envp)
 	mshell = allocate_minishell();
 	if (!mshell)
 		return (NULL);
+	init_env_caches(mshell);
 	if (setup_environment(mshell, envp) == EXIT_FAILURE)
 	{
 		free_minishell(&mshell);
 		return (NULL);
 	}
+	start_spawn_helper(mshell);
 	return (mshell);
 }
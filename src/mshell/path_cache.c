@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file path_cache.c
+ * @brief Keeps `PATH` split into directories between commands.
+ *
+ * The directories are views into the `PATH` variable's own buffer, so
+ * splitting allocates nothing but the `dirs` array, and that only when
+ * `PATH` grows past its capacity. The split is redone only after `PATH`
+ * itself has been set or unset.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Counts the entries (including empty ones) of a `PATH` value.
+ *
+ * @param path The `PATH` value.
+ * @return Number of `:`-separated entries.
+ */
+static size_t	count_path_entries(const char *path)
+{
+	size_t	count;
+
+	count = 1;
+	while (*path)
+	{
+		if (*path == ':')
+			count++;
+		path++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Makes sure `pc->dirs` can hold `needed` entries.
+ *
+ * @param pc Path cache.
+ * @param needed Required number of entries.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+static int	reserve_path_dirs(t_path_cache *pc, size_t needed)
+{
+	t_path_dir	*dirs;
+
+	if (needed <= pc->cap)
+		return (EXIT_SUCCESS);
+	dirs = malloc(sizeof(t_path_dir) * needed);
+	if (!dirs)
+		return (error_return("path cache: malloc failed\n", EXIT_FAILURE));
+	free(pc->dirs);
+	pc->dirs = dirs;
+	pc->cap = needed;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Splits the current `PATH` value into `pc->dirs`.
+ *
+ * Empty entries are skipped, as `ft_split()` used to do.
+ *
+ * @param pc Path cache whose `var.value` holds the current `PATH`.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+static int	split_path(t_path_cache *pc)
+{
+	const char	*start;
+	const char	*end;
+
+	pc->count = 0;
+	if (!pc->var.value)
+		return (EXIT_SUCCESS);
+	if (reserve_path_dirs(pc, count_path_entries(pc->var.value))
+		!= EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	start = pc->var.value;
+	while (*start)
+	{
+		end = start;
+		while (*end && *end != ':')
+			end++;
+		if (end > start)
+		{
+			pc->dirs[pc->count].dir = start;
+			pc->dirs[pc->count].len = end - start;
+			pc->dirs[pc->count].fd = -1;
+			pc->count++;
+		}
+		start = end + (*end == ':');
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Returns the `PATH` directories, re-splitting `PATH` if it changed.
+ *
+ * A changed `PATH` also closes the old directory fds and empties the
+ * miss cache, the `PATH` index and the command table.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ * @return The up-to-date path cache, or NULL if allocation fails.
+ */
+t_path_cache	*get_path_cache(t_mshell *mshell)
+{
+	t_path_cache	*pc;
+
+	pc = &mshell->path_cache;
+	if (!var_cache_changed(mshell, &pc->var))
+		return (pc);
+	close_path_dirs(pc);
+	miss_cache_clear(pc);
+	path_index_reset(&pc->index);
+	cmd_table_clear(&mshell->cmd_table);
+	if (split_path(pc) != EXIT_SUCCESS)
+	{
+		pc->var.env_gen = 0;
+		return (NULL);
+	}
+	return (pc);
+}
+
+/**
+ * @brief Closes the directory fds opened for the current `PATH` entries.
+ *
+ * @param pc Path cache.
+ */
+void	close_path_dirs(t_path_cache *pc)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < pc->count)
+	{
+		if (pc->dirs[i].fd >= 0)
+			close(pc->dirs[i].fd);
+		pc->dirs[i].fd = -1;
+		i++;
+	}
+}
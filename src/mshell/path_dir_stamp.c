@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_dir_stamp.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file path_dir_stamp.c
+ * @brief Directory fds and change detection for the `PATH` directories.
+ *
+ * Adding or removing a file changes its directory's modification time,
+ * so comparing each `PATH` directory with a recorded stamp tells whether
+ * a name that was missing everywhere may have appeared since.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Returns the directory fd of an absolute `PATH` entry.
+ *
+ * The directory is opened on first use and stays open until `PATH`
+ * changes. A directory that cannot be opened is retried next time.
+ *
+ * @param dir Absolute `PATH` entry.
+ * @return The directory fd, or -1 if it cannot be opened.
+ */
+int	path_dir_fd(t_path_dir *dir)
+{
+	char	buf[PATH_MAX];
+
+	if (dir->fd >= 0)
+		return (dir->fd);
+	if (dir->len >= PATH_MAX)
+		return (-1);
+	ft_memcpy(buf, dir->dir, dir->len);
+	buf[dir->len] = '\0';
+	dir->fd = open(buf, PATH_DIR_FLAGS | O_DIRECTORY | O_CLOEXEC);
+	return (dir->fd);
+}
+
+/**
+ * @brief Reads the current state of a `PATH` directory.
+ *
+ * Absolute entries use their directory fd; relative ones are looked up
+ * from the current directory, so a `cd` shows up as a change.
+ *
+ * @param dir `PATH` entry.
+ * @param st Filled with the directory state; zeroed if it is missing.
+ */
+static void	stat_path_dir(t_path_dir *dir, struct stat *st)
+{
+	char	buf[PATH_MAX];
+	int		ret;
+
+	ret = -1;
+	if (dir->dir[0] == '/' && path_dir_fd(dir) >= 0)
+		ret = fstat(dir->fd, st);
+	else if (dir->dir[0] != '/' && dir->len < PATH_MAX)
+	{
+		ft_memcpy(buf, dir->dir, dir->len);
+		buf[dir->len] = '\0';
+		ret = stat(buf, st);
+	}
+	if (ret != 0)
+		ft_memset(st, 0, sizeof(*st));
+}
+
+/**
+ * @brief Records the current state of every `PATH` directory.
+ *
+ * @param pc Path cache.
+ */
+void	path_dirs_stamp(t_path_cache *pc)
+{
+	struct stat	st;
+	size_t		i;
+
+	i = 0;
+	while (i < pc->count)
+	{
+		stat_path_dir(&pc->dirs[i], &st);
+		pc->dirs[i].dev = st.st_dev;
+		pc->dirs[i].ino = st.st_ino;
+		pc->dirs[i].mtime = st.ST_MTIM;
+		i++;
+	}
+}
+
+/**
+ * @brief Tells whether any `PATH` directory changed since the last stamp.
+ *
+ * @param pc Path cache.
+ * @return `true` if a directory appeared, disappeared, was replaced or
+ * had entries added or removed.
+ */
+bool	path_dirs_changed(t_path_cache *pc)
+{
+	struct stat	st;
+	size_t		i;
+	t_path_dir	*dir;
+
+	i = 0;
+	while (i < pc->count)
+	{
+		dir = &pc->dirs[i];
+		stat_path_dir(dir, &st);
+		if (st.st_dev != dir->dev || st.st_ino != dir->ino
+			|| st.ST_MTIM.tv_sec != dir->mtime.tv_sec
+			|| st.ST_MTIM.tv_nsec != dir->mtime.tv_nsec)
+			return (true);
+		i++;
+	}
+	return (false);
+}
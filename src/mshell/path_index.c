@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file path_index.c
+ * @brief Name index of the `PATH` directories.
+ *
+ * Interactive shells list every `PATH` directory once and remember which
+ * directory each name is first found in. A lookup then tells at once
+ * whether a command can exist at all, and in which directory the probe
+ * should start. Names live in one growing arena; slots store offsets.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Finds the slot holding `name`, or the free slot ending its probe.
+ *
+ * @param idx Index with slots allocated.
+ * @param name Name to look for.
+ * @param hash Hash of `name`.
+ * @param len Length of `name`.
+ * @return Index of the matching slot, or of the first free slot.
+ */
+static size_t	pidx_find_slot(t_path_index *idx, const char *name,
+		unsigned int hash, size_t len)
+{
+	size_t		mask;
+	size_t		i;
+	t_pidx_slot	*slot;
+
+	mask = idx->cap - 1;
+	i = hash & mask;
+	slot = &idx->slots[i];
+	while (slot->name_len)
+	{
+		if (slot->hash == hash && slot->name_len == len
+			&& ft_memcmp(idx->names + slot->name_off, name, len) == 0)
+			return (i);
+		i = (i + 1) & mask;
+		slot = &idx->slots[i];
+	}
+	return (i);
+}
+
+/**
+ * @brief Allocates the slots on first use, or doubles them.
+ *
+ * @param idx Path index.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+static int	pidx_grow(t_path_index *idx)
+{
+	t_pidx_slot	*old;
+	size_t		old_cap;
+	size_t		i;
+
+	old = idx->slots;
+	old_cap = idx->cap;
+	idx->cap *= 2;
+	if (idx->cap == 0)
+		idx->cap = PATH_INDEX_MIN_CAP;
+	idx->slots = ft_calloc(idx->cap, sizeof(t_pidx_slot));
+	if (!idx->slots)
+		return (idx->slots = old, idx->cap = old_cap, EXIT_FAILURE);
+	i = 0;
+	while (i < old_cap)
+	{
+		if (old[i].name_len)
+			idx->slots[pidx_find_slot(idx, idx->names + old[i].name_off,
+					old[i].hash, old[i].name_len)] = old[i];
+		i++;
+	}
+	free(old);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Copies a name to the end of the arena.
+ *
+ * @param idx Path index.
+ * @param name NUL-terminated name.
+ * @param len Length of `name`.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+static int	pidx_store_name(t_path_index *idx, const char *name, size_t len)
+{
+	size_t	new_cap;
+	char	*names;
+
+	new_cap = idx->names_cap;
+	if (new_cap == 0)
+		new_cap = MS_PATHMAX;
+	while (idx->names_len + len + 1 > new_cap)
+		new_cap *= 2;
+	if (new_cap != idx->names_cap)
+	{
+		names = ft_realloc(idx->names, idx->names_len, new_cap);
+		if (!names)
+			return (EXIT_FAILURE);
+		idx->names = names;
+		idx->names_cap = new_cap;
+	}
+	ft_memcpy(idx->names + idx->names_len, name, len + 1);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Adds a name found in `PATH` directory `dir`.
+ *
+ * Directories are scanned in `PATH` order, so a name that is already
+ * indexed keeps its earlier directory.
+ *
+ * @param idx Path index.
+ * @param name NUL-terminated name of the directory entry.
+ * @param len Length of `name`.
+ * @param dir Index of the directory in the `PATH` cache.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+int	path_index_add(t_path_index *idx, const char *name, size_t len,
+		size_t dir)
+{
+	t_pidx_slot		*slot;
+	unsigned int	hash;
+	size_t			unused;
+
+	if ((idx->count + 1) * 4 > idx->cap * 3 && pidx_grow(idx) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	hash = hash_function(name, &unused);
+	slot = &idx->slots[pidx_find_slot(idx, name, hash, len)];
+	if (slot->name_len)
+		return (EXIT_SUCCESS);
+	if (pidx_store_name(idx, name, len) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	slot->hash = hash;
+	slot->name_len = len;
+	slot->name_off = idx->names_len;
+	slot->dir = dir;
+	idx->names_len += len + 1;
+	idx->count++;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Looks a name up in the index.
+ *
+ * @param idx Path index.
+ * @param name Command name.
+ * @return The slot of `name`, or NULL if no directory holds it.
+ */
+t_pidx_slot	*path_index_get(t_path_index *idx, const char *name)
+{
+	size_t	i;
+	size_t	unused;
+
+	if (idx->count == 0)
+		return (NULL);
+	i = pidx_find_slot(idx, name, hash_function(name, &unused),
+			ft_strlen(name));
+	if (!idx->slots[i].name_len)
+		return (NULL);
+	return (&idx->slots[i]);
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index_build.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file path_index_build.c
+ * @brief Builds the `PATH` index and decides when it can be used.
+ *
+ * Each directory is read in large batches through `readdir()`. The
+ * index is only used when every `PATH` entry is absolute and watched,
+ * so a lookup never answers from a stale listing. Directories that do
+ * not exist yet are checked for on every lookup instead.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Adds every entry of an open directory to the index.
+ *
+ * @param idx Path index.
+ * @param fd Directory fd; consumed.
+ * @param dir Index of the directory in the `PATH` cache.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` on error.
+ */
+static int	scan_dir(t_path_index *idx, int fd, size_t dir)
+{
+	DIR				*dp;
+	struct dirent	*ent;
+
+	dp = fdopendir(fd);
+	if (!dp)
+	{
+		close(fd);
+		return (EXIT_FAILURE);
+	}
+	ent = readdir(dp);
+	while (ent)
+	{
+		if (ft_strcmp(ent->d_name, ".") != 0
+			&& ft_strcmp(ent->d_name, "..") != 0
+			&& path_index_add(idx, ent->d_name, ft_strlen(ent->d_name), dir)
+			!= EXIT_SUCCESS)
+		{
+			closedir(dp);
+			return (EXIT_FAILURE);
+		}
+		ent = readdir(dp);
+	}
+	closedir(dp);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Watches and scans one `PATH` directory.
+ *
+ * A directory that does not exist is only marked `missing`.
+ *
+ * @param pc Path cache.
+ * @param i Index of the directory.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if the directory is
+ * relative or cannot be watched or read.
+ */
+static int	index_dir(t_path_cache *pc, size_t i)
+{
+	t_path_dir	*dir;
+	char		buf[PATH_MAX];
+	int			fd;
+
+	dir = &pc->dirs[i];
+	if (dir->dir[0] != '/' || dir->len >= PATH_MAX)
+		return (EXIT_FAILURE);
+	ft_memcpy(buf, dir->dir, dir->len);
+	buf[dir->len] = '\0';
+	fd = open(buf, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	dir->missing = (fd < 0 && errno == ENOENT);
+	if (dir->missing)
+		return (EXIT_SUCCESS);
+	if (fd < 0 || path_index_watch_dir(&pc->index, buf) != EXIT_SUCCESS)
+	{
+		if (fd >= 0)
+			close(fd);
+		return (EXIT_FAILURE);
+	}
+	return (scan_dir(&pc->index, fd, i));
+}
+
+/**
+ * @brief Tells whether a `PATH` directory that was missing now exists.
+ *
+ * @param pc Path cache.
+ * @return `true` if one of the missing directories appeared.
+ */
+static bool	missing_dir_appeared(t_path_cache *pc)
+{
+	char	buf[PATH_MAX];
+	size_t	i;
+
+	i = 0;
+	while (i < pc->count)
+	{
+		if (pc->dirs[i].missing)
+		{
+			ft_memcpy(buf, pc->dirs[i].dir, pc->dirs[i].len);
+			buf[pc->dirs[i].len] = '\0';
+			if (access(buf, F_OK) == 0)
+				return (true);
+		}
+		i++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Builds the index from scratch for the current `PATH`.
+ *
+ * The watches are added before each directory is read, so a change made
+ * while scanning is seen on the next lookup.
+ *
+ * @param pc Path cache.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if the index cannot
+ * be used for this `PATH`.
+ */
+int	path_index_build(t_path_cache *pc)
+{
+	size_t	i;
+
+	path_index_reset(&pc->index);
+	if (path_index_watch_init(&pc->index) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	i = 0;
+	while (i < pc->count)
+	{
+		if (index_dir(pc, i) != EXIT_SUCCESS)
+		{
+			path_index_reset(&pc->index);
+			return (EXIT_FAILURE);
+		}
+		i++;
+	}
+	pc->index.valid = true;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Makes sure the index matches the `PATH` directories.
+ *
+ * Rebuilds it after any watched change. If it cannot be built for this
+ * `PATH`, it stays off until `PATH` changes. A read-only index (in a
+ * pipeline child) is used as it was at fork time.
+ *
+ * @param pc Up-to-date path cache.
+ * @return `true` if the index can answer lookups.
+ */
+bool	path_index_ready(t_path_cache *pc)
+{
+	t_path_index	*idx;
+
+	idx = &pc->index;
+	if (!idx->enabled || idx->failed || pc->count == 0)
+		return (false);
+	if (idx->read_only)
+		return (idx->valid);
+	if (idx->valid && (path_index_changed(idx) || missing_dir_appeared(pc)))
+		idx->valid = false;
+	if (!idx->valid && path_index_build(pc) != EXIT_SUCCESS)
+	{
+		idx->failed = true;
+		return (false);
+	}
+	return (true);
+}
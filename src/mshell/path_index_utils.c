@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index_utils.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file path_index_utils.c
+ * @brief Reset, cleanup and pre-fork refresh of the `PATH` index.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Empties the index and drops its watches, keeping the memory.
+ *
+ * @param idx Path index.
+ */
+void	path_index_reset(t_path_index *idx)
+{
+	if (idx->watch_fd >= 0)
+		close(idx->watch_fd);
+	idx->watch_fd = -1;
+	if (idx->count)
+		ft_memset(idx->slots, 0, idx->cap * sizeof(t_pidx_slot));
+	idx->count = 0;
+	idx->names_len = 0;
+	idx->valid = false;
+	idx->failed = false;
+}
+
+/**
+ * @brief Frees the index.
+ *
+ * @param idx Path index.
+ */
+void	path_index_free(t_path_index *idx)
+{
+	path_index_reset(idx);
+	free_ptr((void **)&idx->slots);
+	free_ptr((void **)&idx->names);
+	idx->cap = 0;
+	idx->names_cap = 0;
+}
+
+/**
+ * @brief Brings the index up to date before forking pipeline children.
+ *
+ * The children resolve their own binaries with a read-only copy of the
+ * index, so it is checked once here rather than in every child.
+ *
+ * @param mshell Pointer to the Minishell structure.
+ */
+void	path_index_refresh(t_mshell *mshell)
+{
+	t_path_cache	*pc;
+
+	pc = get_path_cache(mshell);
+	if (pc)
+		path_index_ready(pc);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index_watch.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file path_index_watch.c
+ * @brief inotify watches keeping the `PATH` index fresh.
+ *
+ * Any entry created, removed or renamed in a watched directory, or the
+ * directory itself going away, invalidates the whole index; it is then
+ * rebuilt on the next lookup. Systems without inotify use the stubs in
+ * path_index_watch_stub.c.
+ */
+#include "minishell.h"
+#ifdef __linux__
+# include <sys/inotify.h>
+
+/**
+ * @brief Starts a fresh inotify instance for the index.
+ *
+ * @param idx Path index (any previous instance is already closed).
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if inotify is unavailable.
+ */
+int	path_index_watch_init(t_path_index *idx)
+{
+	idx->watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (idx->watch_fd < 0)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Watches one `PATH` directory for entries coming and going.
+ *
+ * @param idx Path index.
+ * @param dir NUL-terminated directory path.
+ * @return `EXIT_SUCCESS`, or `EXIT_FAILURE` if the watch cannot be added.
+ */
+int	path_index_watch_dir(t_path_index *idx, const char *dir)
+{
+	if (inotify_add_watch(idx->watch_fd, dir, IN_CREATE | IN_DELETE
+			| IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF
+			| IN_ONLYDIR) < 0)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Drains pending events and tells whether there were any.
+ *
+ * The events themselves are not parsed: any of them, including a queue
+ * overflow, means the index must be rebuilt.
+ *
+ * @param idx Path index with an active watch.
+ * @return `true` if a watched directory changed since the last call.
+ */
+bool	path_index_changed(t_path_index *idx)
+{
+	char	buf[4096];
+	bool	changed;
+
+	changed = false;
+	while (read(idx->watch_fd, buf, sizeof(buf)) > 0)
+		changed = true;
+	return (changed);
+}
+#endif
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index_watch_stub.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file path_index_watch_stub.c
+ * @brief `PATH` index watches for systems without inotify.
+ *
+ * Without inotify the index cannot be kept fresh, so it is never built
+ * and lookups probe each `PATH` directory instead.
+ */
+#include "minishell.h"
+#ifndef __linux__
+
+/**
+ * @brief Always fails: there is nothing to watch with.
+ */
+int	path_index_watch_init(t_path_index *idx)
+{
+	(void)idx;
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Always fails; never reached since `path_index_watch_init()` fails.
+ */
+int	path_index_watch_dir(t_path_index *idx, const char *dir)
+{
+	(void)idx;
+	(void)dir;
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Always reports a change, so an index is never trusted.
+ */
+bool	path_index_changed(t_path_index *idx)
+{
+	(void)idx;
+	return (true);
+}
+#endif
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_miss_cache.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file path_miss_cache.c
+ * @brief Remembers command names that are on no `PATH` directory.
+ *
+ * A repeated miss then costs one slot compare plus a stamp check of the
+ * `PATH` directories instead of probing every directory again. The
+ * cache is emptied when `PATH` changes or any of its directories does.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Returns the slot a name maps to.
+ *
+ * @param name Command name.
+ * @return Slot index in `misses`.
+ */
+static size_t	miss_slot(const char *name)
+{
+	size_t	unused;
+
+	return (hash_function(name, &unused) & (PATH_MISS_SLOTS - 1));
+}
+
+/**
+ * @brief Forgets every remembered miss.
+ *
+ * @param pc Path cache.
+ */
+void	miss_cache_clear(t_path_cache *pc)
+{
+	size_t	i;
+
+	if (pc->miss_count == 0)
+		return ;
+	i = 0;
+	while (i < PATH_MISS_SLOTS)
+	{
+		free_ptr((void **)&pc->misses[i]);
+		i++;
+	}
+	pc->miss_count = 0;
+}
+
+/**
+ * @brief Tells whether `name` is known to be on no `PATH` directory.
+ *
+ * If the name is remembered but a directory changed since, the whole
+ * cache is dropped and the name is reported as unknown.
+ *
+ * @param pc Up-to-date path cache.
+ * @param name Command name.
+ * @return `true` if a `PATH` search would fail with 127.
+ */
+bool	miss_cache_hit(t_path_cache *pc, const char *name)
+{
+	char	*miss;
+
+	miss = pc->misses[miss_slot(name)];
+	if (!miss || ft_strcmp(miss, name) != 0)
+		return (false);
+	if (path_dirs_changed(pc))
+	{
+		miss_cache_clear(pc);
+		return (false);
+	}
+	return (true);
+}
+
+/**
+ * @brief Remembers that `name` is on no `PATH` directory.
+ *
+ * The directories are stamped when the first name goes in, right after
+ * the search that missed. Failing to allocate just skips caching.
+ *
+ * @param pc Path cache.
+ * @param name Command name.
+ */
+void	miss_cache_add(t_path_cache *pc, const char *name)
+{
+	size_t	slot;
+	char	*copy;
+
+	copy = ft_strdup(name);
+	if (!copy)
+		return ;
+	if (pc->miss_count == 0)
+		path_dirs_stamp(pc);
+	slot = miss_slot(name);
+	if (pc->misses[slot])
+		free(pc->misses[slot]);
+	else
+		pc->miss_count++;
+	pc->misses[slot] = copy;
+}
+
+/**
+ * @brief Returns the first `PATH` directory worth probing for `name`.
+ *
+ * Uses the `PATH` index when it is available, otherwise the miss cache.
+ *
+ * @param pc Up-to-date path cache.
+ * @param name Command name without a `/`.
+ * @return Index of the first directory to try, or `pc->count` if no
+ * directory holds `name`.
+ */
+size_t	path_search_start(t_path_cache *pc, const char *name)
+{
+	t_pidx_slot	*slot;
+
+	if (path_index_ready(pc))
+	{
+		slot = path_index_get(&pc->index, name);
+		if (!slot)
+			return (pc->count);
+		return (slot->dir);
+	}
+	if (miss_cache_hit(pc, name))
+		return (pc->count);
+	return (0);
+}
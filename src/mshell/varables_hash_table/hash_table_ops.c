@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_table_ops.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file hash_table_ops.c
+ * @brief Lookup and insertion for the variable hash table.
+ *
+ * The table uses open addressing with linear probing. Each slot keeps the
+ * full hash and the key length next to the variable pointer, so a probe
+ * only dereferences a variable when both of them match.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Finds the slot holding `key`, or the free slot ending its probe.
+ *
+ * @param ht Pointer to the hash table.
+ * @param key Variable name.
+ * @param hash Full hash of `key`.
+ * @param len Length of `key`.
+ * @return Index of the matching slot, or of the first free slot.
+ */
+size_t	ht_find_slot(t_hash_tbl *ht, const char *key,
+		unsigned int hash, size_t len)
+{
+	size_t		mask;
+	size_t		i;
+	t_ht_slot	*slot;
+
+	mask = ht->cap - 1;
+	i = hash & mask;
+	slot = &ht->slots[i];
+	while (slot->var)
+	{
+		if (slot->hash == hash && slot->key_len == len
+			&& ft_memcmp(slot->var->key, key, len) == 0)
+			return (i);
+		i = (i + 1) & mask;
+		slot = &ht->slots[i];
+	}
+	return (i);
+}
+
+/**
+ * @brief Looks up a variable by name.
+ *
+ * @param ht Pointer to the hash table.
+ * @param key Variable name.
+ * @return Pointer to the variable, or NULL if it is not set.
+ */
+t_mshell_var	*ht_get(t_hash_tbl *ht, const char *key)
+{
+	unsigned int	hash;
+	size_t			len;
+
+	if (!ht || !key)
+		return (NULL);
+	hash = hash_function(key, &len);
+	return (ht->slots[ht_find_slot(ht, key, hash, len)].var);
+}
+
+/**
+ * @brief Doubles the number of slots and re-places every variable.
+ *
+ * Stored hashes are reused, so no key is hashed or compared again.
+ *
+ * @param ht Pointer to the hash table.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+static int	ht_grow(t_hash_tbl *ht)
+{
+	t_ht_slot	*new_slots;
+	size_t		new_mask;
+	size_t		i;
+	size_t		j;
+
+	new_slots = ft_calloc(ht->cap * 2, sizeof(t_ht_slot));
+	if (!new_slots)
+		return (error_return("ht_grow: malloc failed\n", EXIT_FAILURE));
+	new_mask = ht->cap * 2 - 1;
+	i = 0;
+	while (i < ht->cap)
+	{
+		if (ht->slots[i].var)
+		{
+			j = ht->slots[i].hash & new_mask;
+			while (new_slots[j].var)
+				j = (j + 1) & new_mask;
+			new_slots[j] = ht->slots[i];
+		}
+		i++;
+	}
+	free(ht->slots);
+	ht->slots = new_slots;
+	ht->cap *= 2;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Inserts a variable whose key is not in the table yet.
+ *
+ * Grows the table first if the insertion would push the load factor
+ * above 3/4. The variable is also added to the ordered index.
+ *
+ * @param ht Pointer to the hash table.
+ * @param var Variable to insert.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+int	ht_insert(t_hash_tbl *ht, t_mshell_var *var)
+{
+	unsigned int	hash;
+	size_t			len;
+	size_t			i;
+
+	if (!ht || !var || !var->key)
+		return (EXIT_FAILURE);
+	if ((ht->count + 1) * 4 > ht->cap * 3 && ht_grow(ht) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	if (ht_order_insert(ht, var) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	hash = hash_function(var->key, &len);
+	i = ht_find_slot(ht, var->key, hash, len);
+	ht->slots[i].hash = hash;
+	ht->slots[i].key_len = len;
+	ht->slots[i].var = var;
+	ht->count++;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_table_ops_utils.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file hash_table_ops_utils.c
+ * @brief Removal and iteration for the variable hash table.
+ *
+ * Code that needs to visit every variable goes through `ht_iter_next()`
+ * instead of walking the slot array itself.
+ */
+#include "minishell.h"
+
+/**
+ * @brief Closes the hole left at `hole` by a removed variable.
+ *
+ * Later slots of the same probe run are shifted back whenever the hole lies
+ * between their home slot and their current position, so lookups never
+ * stop early on the freed slot and no tombstones are needed.
+ *
+ * @param ht Pointer to the hash table.
+ * @param hole Index of the slot that was just freed.
+ */
+static void	ht_close_hole(t_hash_tbl *ht, size_t hole)
+{
+	size_t	mask;
+	size_t	i;
+	size_t	home;
+
+	mask = ht->cap - 1;
+	i = (hole + 1) & mask;
+	while (ht->slots[i].var)
+	{
+		home = ht->slots[i].hash & mask;
+		if (((i - home) & mask) >= ((i - hole) & mask))
+		{
+			ht->slots[hole] = ht->slots[i];
+			hole = i;
+		}
+		i = (i + 1) & mask;
+	}
+	ft_memset(&ht->slots[hole], 0, sizeof(t_ht_slot));
+}
+
+/**
+ * @brief Unlinks a variable from the table and the ordered index
+ * without freeing it.
+ *
+ * @param ht Pointer to the hash table.
+ * @param key Variable name.
+ * @return The removed variable, or NULL if `key` was not set.
+ */
+t_mshell_var	*ht_remove(t_hash_tbl *ht, const char *key)
+{
+	t_mshell_var	*var;
+	unsigned int	hash;
+	size_t			len;
+	size_t			i;
+
+	if (!ht || !key)
+		return (NULL);
+	hash = hash_function(key, &len);
+	i = ht_find_slot(ht, key, hash, len);
+	var = ht->slots[i].var;
+	if (!var)
+		return (NULL);
+	ht_order_remove(ht, var);
+	ht_close_hole(ht, i);
+	ht->count--;
+	return (var);
+}
+
+/**
+ * @brief Returns the next variable of the table.
+ *
+ * Start with `*pos` set to 0 and call until NULL is returned. The table
+ * must not be modified while iterating.
+ *
+ * @param ht Pointer to the hash table.
+ * @param pos Iteration cursor, advanced past the returned slot.
+ * @return The next variable, or NULL once every slot has been visited.
+ */
+t_mshell_var	*ht_iter_next(t_hash_tbl *ht, size_t *pos)
+{
+	t_mshell_var	*var;
+
+	if (!ht || !pos)
+		return (NULL);
+	while (*pos < ht->cap)
+	{
+		var = ht->slots[*pos].var;
+		(*pos)++;
+		if (var)
+			return (var);
+	}
+	return (NULL);
+}
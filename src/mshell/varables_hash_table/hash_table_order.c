@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_table_order.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file hash_table_order.c
+ * @brief Name-ordered index of the variable hash table.
+ *
+ * `ht->order` lists every variable sorted by name. Inserting or removing
+ * a variable finds its position by binary search and shifts the pointers
+ * after it one at a time (`ft_memmove()` would copy them byte by byte),
+ * so `export` can walk the variables in order directly. While the
+ * environment is imported, the index is only appended to and sorted once
+ * at the end (see `ht_order_sort()`).
+ */
+#include "minishell.h"
+
+/**
+ * @brief Compares a variable's name with a name of known length.
+ *
+ * Gives the same order as `ft_strcmp()` on the bare names.
+ *
+ * @param var Variable whose name is compared.
+ * @param key Name to compare with (need not be NUL-terminated).
+ * @param len Length of `key`.
+ * @return Negative, zero or positive, like `ft_strcmp()`.
+ */
+int	var_name_cmp(const t_mshell_var *var, const char *key, size_t len)
+{
+	size_t	min;
+	int		diff;
+
+	min = var->key_len;
+	if (len < min)
+		min = len;
+	diff = ft_memcmp(var->key, key, min);
+	if (diff != 0)
+		return (diff);
+	if (var->key_len < len)
+		return (-1);
+	return (var->key_len > len);
+}
+
+/**
+ * @brief Finds the first position whose name is not less than `key`.
+ *
+ * @param ht Pointer to the hash table.
+ * @param key Name to look for.
+ * @param len Length of `key`.
+ * @return Index in `ht->order`, between 0 and `ht->count`.
+ */
+static size_t	order_lower_bound(t_hash_tbl *ht, const char *key, size_t len)
+{
+	size_t	lo;
+	size_t	hi;
+	size_t	mid;
+
+	lo = 0;
+	hi = ht->count;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (var_name_cmp(ht->order[mid], key, len) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo);
+}
+
+/**
+ * @brief Makes room for one more entry in `ht->order`.
+ *
+ * @param ht Pointer to the hash table.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+static int	order_reserve(t_hash_tbl *ht)
+{
+	t_mshell_var	**new_order;
+	size_t			new_cap;
+
+	if (ht->count < ht->order_cap)
+		return (EXIT_SUCCESS);
+	new_cap = ht->order_cap * 2;
+	if (new_cap < HT_MIN_CAP)
+		new_cap = HT_MIN_CAP;
+	new_order = ft_realloc(ht->order, sizeof(t_mshell_var *) * ht->order_cap,
+			sizeof(t_mshell_var *) * new_cap);
+	if (!new_order)
+		return (error_return("ht_order_insert: malloc failed\n",
+				EXIT_FAILURE));
+	ht->order = new_order;
+	ht->order_cap = new_cap;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Adds a variable to the ordered index.
+ *
+ * Must be called before the variable is counted in `ht->count`.
+ * While `ht->order_dirty` is set the variable is simply appended.
+ *
+ * @param ht Pointer to the hash table.
+ * @param var Variable being inserted into the table.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+int	ht_order_insert(t_hash_tbl *ht, t_mshell_var *var)
+{
+	size_t	pos;
+	size_t	i;
+
+	if (order_reserve(ht) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	pos = ht->count;
+	if (!ht->order_dirty)
+		pos = order_lower_bound(ht, var->key, var->key_len);
+	i = ht->count;
+	while (i > pos)
+	{
+		ht->order[i] = ht->order[i - 1];
+		i--;
+	}
+	ht->order[pos] = var;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Removes a variable from the ordered index.
+ *
+ * Must be called while the variable is still counted in `ht->count`.
+ *
+ * @param ht Pointer to the hash table.
+ * @param var Variable being removed from the table.
+ */
+void	ht_order_remove(t_hash_tbl *ht, t_mshell_var *var)
+{
+	size_t	pos;
+
+	if (ht->order_dirty)
+	{
+		pos = 0;
+		while (pos < ht->count && ht->order[pos] != var)
+			pos++;
+	}
+	else
+		pos = order_lower_bound(ht, var->key, var->key_len);
+	if (pos >= ht->count || ht->order[pos] != var)
+		return ;
+	while (++pos < ht->count)
+		ht->order[pos - 1] = ht->order[pos];
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_table_order_utils.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: imunaev- <imunaev-@student.hive.fi>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by imunaev-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by imunaev-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file hash_table_order_utils.c
+ * @brief One-shot sorting of the name-ordered index.
+ *
+ * Used after importing the environment, when the variables were appended
+ * to `ht->order` unsorted. A merge sort orders them in O(n log n).
+ */
+#include "minishell.h"
+
+/**
+ * @brief Merges the two sorted halves `arr[0, half)` and `arr[half, n)`.
+ *
+ * Once the left half is used up, the rest of the right half is already
+ * in place.
+ *
+ * @param arr Array whose halves are sorted.
+ * @param tmp Scratch space for `n` pointers.
+ * @param half Size of the left half.
+ * @param n Total number of entries.
+ */
+static void	merge_halves(t_mshell_var **arr, t_mshell_var **tmp,
+		size_t half, size_t n)
+{
+	size_t	i;
+	size_t	j;
+	size_t	k;
+
+	ft_memcpy(tmp, arr, sizeof(t_mshell_var *) * n);
+	i = 0;
+	j = half;
+	k = 0;
+	while (i < half)
+	{
+		if (j < n && var_name_cmp(tmp[j], tmp[i]->key, tmp[i]->key_len) < 0)
+		{
+			arr[k] = tmp[j];
+			j++;
+		}
+		else
+		{
+			arr[k] = tmp[i];
+			i++;
+		}
+		k++;
+	}
+}
+
+/**
+ * @brief Sorts `n` variables by name.
+ *
+ * @param arr Variables to sort.
+ * @param tmp Scratch space for `n` pointers.
+ * @param n Number of variables.
+ */
+static void	merge_sort(t_mshell_var **arr, t_mshell_var **tmp, size_t n)
+{
+	size_t	half;
+
+	if (n < 2)
+		return ;
+	half = n / 2;
+	merge_sort(arr, tmp, half);
+	merge_sort(arr + half, tmp, n - half);
+	merge_halves(arr, tmp, half, n);
+}
+
+/**
+ * @brief Sorts the ordered index and leaves bulk-append mode.
+ *
+ * Does nothing if `ht->order_dirty` is not set.
+ *
+ * @param ht Pointer to the hash table.
+ * @return `EXIT_SUCCESS` on success, `EXIT_FAILURE` if allocation fails.
+ */
+int	ht_order_sort(t_hash_tbl *ht)
+{
+	t_mshell_var	**tmp;
+
+	if (!ht || !ht->order_dirty)
+		return (EXIT_SUCCESS);
+	tmp = malloc(sizeof(t_mshell_var *) * (ht->count + 1));
+	if (!tmp)
+		return (error_return("ht_order_sort: malloc failed\n", EXIT_FAILURE));
+	merge_sort(ht->order, tmp, ht->count);
+	free(tmp);
+	ht->order_dirty = false;
+	return (EXIT_SUCCESS);
+}
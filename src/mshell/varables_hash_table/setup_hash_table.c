@@ -57,36 +57,40 @@ static int	add_oldpwd_from_home(t_mshell *mshell)
 /**
  * @brief Loads the environment array into the hash table.
  *
- * Iterates over mshell->env and populates hash table.
+ * Reads `env` once and populates the hash table. Every inserted variable
+ * is exported into mshell->env as it is set. The name-ordered index is
+ * sorted once at the end rather than kept sorted entry by entry.
  *
  * @param mshell Shell instance.
+ * @param env The process environment.
  * @return EXIT_SUCCESS or EXIT_FAILURE.
  */
-static int	load_env_into_ht(t_mshell *mshell)
+static int	load_env_into_ht(t_mshell *mshell, char **env)
 {
 	int	i;
 
+	mshell->hash_table->order_dirty = true;
 	i = 0;
-	while (mshell->env[i])
+	while (env[i])
 	{
-		if (insert_env_var(mshell, mshell->env[i]) != EXIT_SUCCESS)
+		if (insert_env_var(mshell, env[i]) != EXIT_SUCCESS)
 			return (EXIT_FAILURE);
 		i++;
 	}
+	if (ht_order_sort(mshell->hash_table) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
 	return (add_oldpwd_from_home(mshell));
 }
 
 /**
- * @brief Initializes an empty hash table.
- *
- * Allocates and zeroes all bucket pointers.
+ * @brief Allocates an empty hash table sized for `hint` variables.
  *
- * @return Pointer to hash table, or NULL on failure.
+ * @param hint Expected number of variables.
+ * @return Pointer to the table, or NULL on failure.
  */
-static t_hash_tbl	*init_hash_tbl(void)
+t_hash_tbl	*ht_create(size_t hint)
 {
 	t_hash_tbl	*ht;
-	int			i;
 
 	ht = malloc(sizeof(t_hash_tbl));
 	if (!ht)
@@ -95,35 +99,47 @@ static t_hash_tbl	*init_hash_tbl(void)
 		return (NULL);
 	}
 	ft_memset(ht, 0, sizeof(t_hash_tbl));
-	i = 0;
-	while (i < HASH_SIZE)
-		ht->buckets[i++] = NULL;
+	ht->cap = HT_MIN_CAP;
+	while (ht->cap * 3 < hint * 4)
+		ht->cap *= 2;
+	ht->slots = ft_calloc(ht->cap, sizeof(t_ht_slot));
+	ht->order = malloc(sizeof(t_mshell_var *) * ht->cap);
+	if (!ht->slots || !ht->order)
+	{
+		print_error("-minishell: hash_table slots malloc failed\n");
+		free(ht->slots);
+		free(ht->order);
+		free(ht);
+		return (NULL);
+	}
+	ht->order_cap = ht->cap;
 	return (ht);
 }
 
 /**
  * @brief Sets up the shell's hash table and populates it from env.
  *
+ * The table is sized for the number of entries in `env` up front.
+ *
  * @param mshell Shell instance.
+ * @param env The process environment.
  * @return EXIT_SUCCESS or EXIT_FAILURE.
  */
-int	setup_hash_table(t_mshell *mshell)
+int	setup_hash_table(t_mshell *mshell, char **env)
 {
 	if (!mshell)
 	{
 		print_error("-minishell: no minishell structure\n");
 		return (EXIT_FAILURE);
 	}
-	mshell->hash_table = init_hash_tbl();
+	mshell->hash_table = ht_create(ft_arr_size(env));
 	if (!mshell->hash_table)
 		return (EXIT_FAILURE);
-	if (load_env_into_ht(mshell) != EXIT_SUCCESS)
+	if (load_env_into_ht(mshell, env) != EXIT_SUCCESS)
 	{
 		free_hash_table(mshell->hash_table);
 		mshell->hash_table = NULL;
 		return (EXIT_FAILURE);
 	}
-	if (update_env(mshell) != EXIT_SUCCESS)
-		return (EXIT_FAILURE);
 	return (EXIT_SUCCESS);
 }
@@ -18,25 +18,25 @@
 #include "minishell.h"
 
 /**
- * @brief Parses and inserts one env entry to hash table.
+ * @brief Inserts one env entry to hash table.
+ *
+ * The entry is passed as is: the name ends at the first `=`.
  *
  * @param mshell Shell instance.
  * @param entry Key=value environment string.
  */
 int	insert_env_var(t_mshell *mshell, char *entry)
 {
-	t_mshell_var	*tmp;
+	char	*value;
 
-	tmp = split_key_value(entry);
-	if (!tmp)
-		return (EXIT_FAILURE);
-	if (set_variable(mshell, tmp->key, tmp->value, 1) != EXIT_SUCCESS)
+	value = ft_strchr(entry, '=');
+	if (value)
+		value++;
+	if (set_variable(mshell, entry, value, 1) != EXIT_SUCCESS)
 	{
-		free_pair(&tmp);
 		print_error("-minishell: failed to insert env var\n");
 		return (EXIT_FAILURE);
 	}
-	free_pair(&tmp);
 	return (EXIT_SUCCESS);
 }
 
@@ -66,9 +66,11 @@ uint8_t	update_shlvl_setup_no_env(t_mshell *minishell)
  * @brief Sets or updates an environment variable.
  *
  * If key exists, updates value. Otherwise inserts new variable.
+ * The variable's `env` slot is updated to match, and the environment
+ * generation is bumped.
  *
  * @param mshell Pointer to Minishell.
- * @param key Variable name.
+ * @param key Variable name, terminated by `\0` or `=`.
  * @param value Variable value.
  * @param assigned Assignment flag.
  * @return EXIT_SUCCESS or EXIT_FAILURE.
@@ -76,28 +78,26 @@ uint8_t	update_shlvl_setup_no_env(t_mshell *minishell)
 int	set_variable(t_mshell *mshell, char *key, char *value, int assigned)
 {
 	t_mshell_var	*mshell_var;
-	unsigned int	index;
 
 	if (!mshell || !key || !mshell->hash_table)
 	{
 		print_error("-minishell: set_variable: null pointer argument\n");
 		return (EXIT_FAILURE);
 	}
-	index = hash_function(key);
-	mshell_var = mshell->hash_table->buckets[index];
-	while (mshell_var)
-	{
-		if (ft_strcmp(mshell_var->key, key) == 0)
-			return (update_existing_var(mshell_var, value, assigned));
-		mshell_var = mshell_var->next;
-	}
-	return (insert_new_var(mshell, key, value, assigned));
+	mshell_var = ht_get(mshell->hash_table, key);
+	if (!mshell_var)
+		return (insert_new_var(mshell, key, value, assigned));
+	if (update_existing_var(mshell_var, value, assigned) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	mark_env_changed(mshell, mshell_var);
+	return (sync_env_slot(mshell, mshell_var));
 }
 
 /**
  * @brief Inserts a new variable into the hash table.
  *
- * Computes hash index and inserts at bucket head.
+ * Adds the variable to the hash table, then exports it if it is
+ * assigned.
  *
  * @param mshell Pointer to shell instance.
  * @param key Variable name.
@@ -109,7 +109,6 @@ int	insert_new_var(t_mshell *mshell, char *key,
 		char *value, int assigned)
 {
 	t_mshell_var	*new_var;
-	unsigned int	index;
 
 	if (!mshell || !mshell->hash_table || !key)
 	{
@@ -119,16 +118,20 @@ int	insert_new_var(t_mshell *mshell, char *key,
 	new_var = create_new_var(key, value, assigned);
 	if (!new_var)
 		return (EXIT_FAILURE);
-	index = hash_function(key);
-	new_var->next = mshell->hash_table->buckets[index];
-	mshell->hash_table->buckets[index] = new_var;
-	return (EXIT_SUCCESS);
+	if (ht_insert(mshell->hash_table, new_var) != EXIT_SUCCESS)
+	{
+		free_mshell_var(new_var);
+		return (EXIT_FAILURE);
+	}
+	mark_env_changed(mshell, new_var);
+	return (sync_env_slot(mshell, new_var));
 }
 
 /**
  * @brief Updates value and assignment flag of an existing variable.
  *
- * Replaces the variable's value if a new one is given.
+ * Rebuilds the variable's `KEY=VALUE` buffer with the new value. Declaring
+ * an existing variable without a value (`export VAR`) keeps it unchanged.
  *
  * @param var Pointer to the variable to update.
  * @param value New value string (can be NULL).
@@ -137,19 +140,12 @@ int	insert_new_var(t_mshell *mshell, char *key,
  */
 int	update_existing_var(t_mshell_var *mshell_var, char *value, int assigned)
 {
-	char	*dup;
-
-	if (value)
-	{
-		dup = ft_strdup(value);
-		if (!dup)
-		{
-			print_error("-minishell: update_existing_var, strdup failed\n");
-			return (EXIT_FAILURE);
-		}
-		free(mshell_var->value);
-		mshell_var->value = dup;
-	}
-	mshell_var->val_assigned = assigned;
+	if (!assigned)
+		return (EXIT_SUCCESS);
+	if (!value)
+		value = "";
+	if (set_var_entry(mshell_var, mshell_var->key, value) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	mshell_var->val_assigned = 1;
 	return (EXIT_SUCCESS);
 }
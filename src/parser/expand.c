@@ -41,7 +41,8 @@ char	*get_exit_code(t_mshell *minishell)
 /**
  * @brief Retrieve the value of an environment variable.
  *
- * If var == "?", returns the exit code string. Otherwise searches first in
+ * If var == "?", returns the exit code string, and `PIPESTATUS` the
+ * statuses of the last foreground command. Otherwise searches first in
  * the shell's hash‐table (ms_getenv), then falls back to the raw envp array.
  *
  * @param var        Name of the variable (NUL‐terminated).
@@ -57,6 +58,8 @@ char	*get_env_value(const char *var, t_mshell *minishell)
 
 	if (ft_strcmp((char *)var, "?") == 0)
 		return (get_exit_code(minishell));
+	if (ft_strcmp((char *)var, "PIPESTATUS") == 0 && minishell->pipestatus)
+		return (ft_strdup(minishell->pipestatus));
 	value = ms_getenv(minishell, (char *)var);
 	if (value)
 		return (ft_strdup(value));
@@ -145,7 +148,8 @@ char	*expand_tilde(const char *input, size_t *i, t_mshell *mshell,
 	double_q = (quote_style == 2);
 	if (is_literal_tilde(input, i, single_q, double_q))
 		return (ft_strdup("~"));
-	home = ms_getenv(mshell, "HOME");
+	(void)var_cache_changed(mshell, &mshell->home_cache);
+	home = mshell->home_cache.value;
 	(*i)++;
 	if (!home || !*home)
 		return (ft_strdup("~"));
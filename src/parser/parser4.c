@@ -54,3 +54,33 @@ int	handle_redir(t_parse_ctx *ctx)
 		return (-1);
 	return (0);
 }
+
+/**
+ * @brief Handles a `&` token.
+ *
+ * Only a `&` that ends the line after a command is accepted; it runs
+ * the whole pipeline in the background. Anywhere else it is a syntax
+ * error.
+ *
+ * @param ctx Parser context.
+ * @return 0 on success, `ERROR_UNEXPECTED_TOKEN` for a misplaced `&`.
+ */
+int	process_background_token(t_parse_ctx *ctx)
+{
+	int	next;
+
+	next = ctx->i + 1;
+	while (next < ctx->tokens->count
+		&& (ctx->tokens->tokens[next].type == TOKEN_EOF
+			|| ctx->tokens->tokens[next].type == TOKEN_EMPTY))
+		next++;
+	if (next < ctx->tokens->count || !*ctx->current || !*ctx->cmd_list)
+	{
+		print_error("syntax error near unexpected token `&'\n");
+		free_cmd_list(ctx->cmd_list);
+		return (ERROR_UNEXPECTED_TOKEN);
+	}
+	((t_cmd *)(*ctx->cmd_list)->content)->background = true;
+	ctx->i = next;
+	return (0);
+}
@@ -13,11 +13,13 @@
 #include "../include/minishell.h"
 
 /**
- * @brief Finalizes the command list by normalizing argv and resolving binaries.
+ * @brief Finalizes the command list by normalizing argv.
  *
  * For each command:
  * - Fills remaining argv slots with NULL.
- * - Resolves and assigns the binary path.
+ * - Links it to the head of the list.
+ *
+ * Binaries are resolved later by the executor (see `run_executor_core()`).
  *
  * @param head The head of the command linked list.
  */
@@ -39,7 +41,6 @@ t_cmd	*finalize_commands(t_cmd *head)
 			while (j < MAX_ARGS)
 				cmd_ptr->argv[j++] = NULL;
 		}
-		cmd_ptr->binary = find_binary(cmd_ptr);
 		cmd_ptr->origin_head = head;
 		cmd_ptr = cmd_ptr->next;
 	}
@@ -104,32 +105,34 @@ static int	process_word_token(t_mshell *sh, t_list **cmd_list, t_cmd **current,
 /**
  * @brief Iterates through tokens and builds command list.
  *
+ * A trailing `&` marks the pipeline to run in the background.
+ *
  * @param ctx Full parser context with references to shell, tokens,
  * and current state.
- * @return 0 on success, -1 on failure.
+ * @return 0 on success, -1 on failure, `ERROR_UNEXPECTED_TOKEN` on a
+ * syntax error.
  */
 int	parse_tokens(t_parse_ctx *ctx)
 {
-	int	retval;
+	int			retval;
+	t_TokenType	type;
 
 	while (ctx->tokens && ctx->i < ctx->tokens->count)
 	{
-		if (ctx->tokens->tokens[ctx->i].type == TOKEN_PIPE)
+		type = ctx->tokens->tokens[ctx->i].type;
+		if (type == TOKEN_PIPE)
 			process_pipe_token(ctx->current, &ctx->i);
-		else if (is_input_redir(ctx->tokens->tokens[ctx->i].type)
-			|| is_output_redir(ctx->tokens->tokens[ctx->i].type))
+		else if (is_input_redir(type) || is_output_redir(type))
 		{
 			retval = handle_redir(ctx);
 			if (retval != 0)
 				return (retval);
 		}
-		else if (ctx->tokens->tokens[ctx->i].type == TOKEN_WORD)
-		{
-			if (process_word_token(ctx->shell, ctx->cmd_list, ctx->current,
-					&ctx->tokens->tokens[ctx->i]) < 0)
-				return (-1);
-			ctx->i++;
-		}
+		else if (type == TOKEN_BACKGROUND)
+			return (process_background_token(ctx));
+		else if (type == TOKEN_WORD && process_word_token(ctx->shell,
+				ctx->cmd_list, ctx->current, &ctx->tokens->tokens[ctx->i]) < 0)
+			return (-1);
 		else
 			ctx->i++;
 	}
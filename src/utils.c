@@ -12,9 +12,26 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Tells whether `MINISHELL_DEBUG` was set when the shell started.
+ *
+ * `getenv()` scans the whole process environment, and this is asked
+ * many times per command, so the answer is looked up once. The shell
+ * never changes its process environment, so it cannot go stale.
+ *
+ * @return true in debug mode.
+ */
 bool	is_debug_mode(void)
 {
-	return (getenv("MINISHELL_DEBUG") != NULL);
+	static bool	checked;
+	static bool	debug;
+
+	if (!checked)
+	{
+		debug = (getenv("MINISHELL_DEBUG") != NULL);
+		checked = true;
+	}
+	return (debug);
 }
 
 /**
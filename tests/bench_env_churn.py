@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""Per-command cost of changing the environment as the environment grows.
+
+The shell starts with VARS exported variables and runs COMMANDS lines
+that alternately export and unset one variable, each of which also
+updates `$_`. The time of an empty run with the same environment is
+subtracted, and the rest is reported per command, in microseconds.
+Each run is repeated three times and the best time counts. The cost
+should stay flat as VARS grows.
+
+The shell is started straight from here: env(1) and bash both take
+seconds to pass on tens of thousands of variables.
+
+Usage: tests/bench_env_churn.py [minishell] [commands] [vars ...]
+"""
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+binary = os.path.realpath(sys.argv[1] if len(sys.argv) > 1 else './minishell')
+commands = int(sys.argv[2]) if len(sys.argv) > 2 else 2000
+sizes = [int(n) for n in sys.argv[3:]] or [10, 1000, 5000]
+if not os.access(binary, os.X_OK):
+    sys.exit('Minishell executable not found or not executable at ' + binary)
+
+
+def best_us(script, env):
+    """Best of three run times of `script`, in microseconds."""
+    best = None
+    for _ in range(3):
+        with open(script) as stdin:
+            start = time.perf_counter()
+            subprocess.run([binary], stdin=stdin, stdout=subprocess.DEVNULL,
+                           stderr=subprocess.DEVNULL, env=env)
+            took = time.perf_counter() - start
+        best = took if best is None else min(best, took)
+    return best * 1e6
+
+
+with tempfile.TemporaryDirectory() as tmp:
+    base = os.path.join(tmp, 'base')
+    churn = os.path.join(tmp, 'churn')
+    open(base, 'w').close()
+    with open(churn, 'w') as f:
+        for i in range(commands // 2):
+            f.write('export BENCH_CHURN=%d\nunset BENCH_CHURN\n' % i)
+    print('%8s %12s' % ('vars', 'us/command'))
+    for size in sizes:
+        env = {'PATH': '/usr/bin:/bin', 'HOME': tmp}
+        env.update(('BENCH_VAR_%d' % i, 'value_%d' % i) for i in range(size))
+        cost = (best_us(churn, env) - best_us(base, env)) / commands
+        print('%8d %12.1f' % (size, cost))
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+"""Start-up cost of minishell as the inherited environment grows.
+
+The shell is started with VARS exported variables and an empty script,
+so it imports the environment, builds its tables and exits. The same
+environment is handed to true(1) as a reference for what the kernel
+spends copying it. Each run is repeated five times and the best time
+counts; both are reported in milliseconds, with the difference. The
+difference should grow about linearly with VARS.
+
+The shell is started straight from here: env(1) and bash both take
+seconds to pass on tens of thousands of variables.
+
+Usage: tests/bench_env_startup.py [minishell] [vars ...]
+"""
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+binary = os.path.realpath(sys.argv[1] if len(sys.argv) > 1 else './minishell')
+sizes = [int(n) for n in sys.argv[2:]] or [10, 1000, 50000]
+true = shutil.which('true') or '/bin/true'
+if not os.access(binary, os.X_OK):
+    sys.exit('Minishell executable not found or not executable at ' + binary)
+
+
+def best_ms(argv, env):
+    """Best of five run times of `argv` with an empty stdin, in ms."""
+    best = None
+    for _ in range(5):
+        start = time.perf_counter()
+        subprocess.run(argv, stdin=subprocess.DEVNULL,
+                       stdout=subprocess.DEVNULL,
+                       stderr=subprocess.DEVNULL, env=env)
+        took = time.perf_counter() - start
+        best = took if best is None else min(best, took)
+    return best * 1e3
+
+
+with tempfile.TemporaryDirectory() as tmp:
+    print('%8s %10s %10s %10s' % ('vars', 'shell ms', 'true ms', 'diff ms'))
+    for size in sizes:
+        env = {'PATH': '/usr/bin:/bin', 'HOME': tmp}
+        env.update(('B%d' % i, str(i)) for i in range(size))
+        shell = best_ms([binary], env)
+        ref = best_ms([true], env)
+        print('%8d %10.2f %10.2f %10.2f' % (size, shell, ref, shell - ref))
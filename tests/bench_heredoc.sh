@@ -0,0 +1,76 @@
+#!/bin/bash
+
+# Time to read a here-document and hand it to a command, by body size.
+#
+# For each size the shell runs
+#   cat <<EOF | md5sum
+# followed by a body of 64-byte lines totalling that many KiB, and the
+# checksum is compared with the body's own. An empty heredoc is timed
+# too and subtracted. The best of three runs is reported in milliseconds
+# and MiB/s.
+#
+# Usage: tests/bench_heredoc.sh [minishell] [KiB ...]
+
+MINISHELL_PATH=$(realpath "${1:-./minishell}")
+shift $(( $# < 1 ? $# : 1 ))
+SIZES=${*:-1 1024 102400}
+
+if [ ! -x "$MINISHELL_PATH" ]; then
+    echo "Minishell executable not found or not executable at $MINISHELL_PATH"
+    exit 1
+fi
+
+TMP_DIR=$(mktemp -d)
+trap 'rm -rf "$TMP_DIR"' EXIT
+STATUS=0
+
+# Writes a script feeding a body of $1 KiB to `cat | md5sum`, and the
+# body's checksum to $TMP_DIR/sum.
+make_script() {
+    local line
+    line=$(printf '%063d' 0 | tr 0 x)
+    yes "$line" | head -n $(( $1 * 16 )) > "$TMP_DIR/body"
+    md5sum < "$TMP_DIR/body" | cut -d ' ' -f 1 > "$TMP_DIR/sum"
+    { echo "cat <<EOF | md5sum"; cat "$TMP_DIR/body"; echo "EOF"; } \
+        > "$TMP_DIR/script"
+}
+
+# Prints the best of three run times of the script, in microseconds, or
+# FAIL if the checksum does not match.
+best_us() {
+    local best=0 start end us i
+    for i in 1 2 3; do
+        start=$(date +%s%N)
+        (cd "$TMP_DIR" && env -i PATH=/usr/bin:/bin HOME="$TMP_DIR" \
+            "$MINISHELL_PATH" < "$TMP_DIR/script" > "$TMP_DIR/out" 2>&1)
+        end=$(date +%s%N)
+        if [ "$(head -n 1 "$TMP_DIR/out" | cut -d ' ' -f 1)" \
+            != "$(cat "$TMP_DIR/sum")" ]; then
+            echo "FAIL"
+            return
+        fi
+        us=$(( (end - start) / 1000 ))
+        if (( best == 0 || us < best )); then
+            best=$us
+        fi
+    done
+    echo "$best"
+}
+
+make_script 0
+BASE=$(best_us)
+printf '%10s %10s %10s\n' "KiB" "ms" "MiB/s"
+for SIZE in $SIZES; do
+    make_script "$SIZE"
+    US=$(best_us)
+    if [ "$US" = "FAIL" ]; then
+        printf '%10s %10s\n' "$SIZE" "FAIL"
+        head -n 3 "$TMP_DIR/out"
+        STATUS=1
+        continue
+    fi
+    US=$(( US > BASE ? US - BASE : 1 ))
+    printf '%10s %10s %10s\n' "$SIZE" "$(( US / 1000 ))" \
+        "$(( SIZE * 1000000 / 1024 / US ))"
+done
+exit "$STATUS"
@@ -0,0 +1,144 @@
+#!/bin/bash
+
+# Allocations and time a PATH lookup costs the shell, as PATH grows.
+#
+# PATH is DIRS empty directories followed by /usr/bin:/bin. For each size
+# the shell runs COMMANDS lines of
+#   hit:  true        against  /bin/true
+#   miss: nosuch_<i>  against  ./nosuch_<i>
+# The second script of each pair does the same work without searching
+# PATH, so the difference is what the lookups cost. The miss names are
+# all distinct, so every one walks the whole of PATH.
+# A preloaded shim counts malloc() calls in the shell itself (children
+# drop it) and writes the total at exit. Allocations are reported per
+# lookup; with PATH unchanged a lookup should allocate nothing beyond
+# what a direct path does. The miss script is also timed, best of three,
+# against the same script with PATH=/usr/bin:/bin, and the difference
+# is reported in microseconds per lookup.
+#
+# Usage: tests/bench_path_lookup.sh [minishell] [commands] [dirs ...]
+
+MINISHELL_PATH=$(realpath "${1:-./minishell}")
+COMMANDS=${2:-1000}
+shift $(( $# < 2 ? $# : 2 ))
+SIZES=${*:-0 10 50}
+
+if [ ! -x "$MINISHELL_PATH" ]; then
+    echo "Minishell executable not found or not executable at $MINISHELL_PATH"
+    exit 1
+fi
+
+TMP_DIR=$(mktemp -d)
+trap 'rm -rf "$TMP_DIR"' EXIT
+
+cat > "$TMP_DIR/count.c" <<'SHIM'
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static unsigned long calls;
+static pid_t owner;
+static char out[4096];
+
+void *malloc(size_t size)
+{
+    static void *(*real)(size_t);
+
+    if (!real)
+        real = (void *(*)(size_t))dlsym(RTLD_NEXT, "malloc");
+    calls++;
+    return real(size);
+}
+
+__attribute__((constructor)) static void start(void)
+{
+    const char *path = getenv("BENCH_MALLOC_OUT");
+
+    owner = getpid();
+    if (path)
+        strncpy(out, path, sizeof(out) - 1);
+    unsetenv("LD_PRELOAD");
+    unsetenv("BENCH_MALLOC_OUT");
+}
+
+__attribute__((destructor)) static void stop(void)
+{
+    char line[32];
+    int fd;
+
+    if (getpid() != owner || !out[0])
+        return ;
+    fd = open(out, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return ;
+    write(fd, line, snprintf(line, sizeof(line), "%lu\n", calls));
+    close(fd);
+}
+SHIM
+if ! cc -shared -fPIC -O2 -o "$TMP_DIR/count.so" "$TMP_DIR/count.c" -ldl; then
+    echo "Could not build the malloc counting shim"
+    exit 1
+fi
+
+# Runs script $1 with PATH $2 and prints the shell's malloc() count.
+count_mallocs() {
+    (cd "$TMP_DIR" && env -i PATH="$2" HOME="$TMP_DIR" \
+        BENCH_MALLOC_OUT="$TMP_DIR/count" LD_PRELOAD="$TMP_DIR/count.so" \
+        "$MINISHELL_PATH" < "$1" > /dev/null 2>&1)
+    cat "$TMP_DIR/count"
+}
+
+# Prints the best of three run times of script $1 with PATH $2, in us.
+best_us() {
+    local best=0 start end us i
+    for i in 1 2 3; do
+        start=$(date +%s%N)
+        (cd "$TMP_DIR" && env -i PATH="$2" HOME="$TMP_DIR" \
+            "$MINISHELL_PATH" < "$1" > /dev/null 2>&1)
+        end=$(date +%s%N)
+        us=$(( (end - start) / 1000 ))
+        if (( best == 0 || us < best )); then
+            best=$us
+        fi
+    done
+    echo "$best"
+}
+
+# Writes $2 lines of printf format $1, numbered from 1.
+make_script() {
+    local i
+    for (( i = 1; i <= $2; i++ )); do
+        printf "$1\n" "$i"
+    done
+}
+
+# Prints ($1 - $2) / COMMANDS with $3 decimals.
+per_command() {
+    awk -v a="$1" -v b="$2" -v n="$COMMANDS" -v d="$3" \
+        'BEGIN { printf "%.*f\n", d, (a - b) / n }'
+}
+
+make_script "true" "$COMMANDS" > "$TMP_DIR/hit"
+make_script "/bin/true" "$COMMANDS" > "$TMP_DIR/hit_base"
+make_script "nosuch_%d" "$COMMANDS" > "$TMP_DIR/miss"
+make_script "./nosuch_%d" "$COMMANDS" > "$TMP_DIR/miss_base"
+MISS_US=$(best_us "$TMP_DIR/miss" /usr/bin:/bin)
+printf '%8s %12s %12s %12s\n' "dirs" "hit allocs" "miss allocs" "miss us"
+for SIZE in $SIZES; do
+    DIRS=""
+    for (( i = 0; i < SIZE; i++ )); do
+        mkdir -p "$TMP_DIR/dir$i"
+        DIRS+="$TMP_DIR/dir$i:"
+    done
+    P="${DIRS}/usr/bin:/bin"
+    HIT=$(per_command "$(count_mallocs "$TMP_DIR/hit" "$P")" \
+        "$(count_mallocs "$TMP_DIR/hit_base" "$P")" 2)
+    MISS=$(per_command "$(count_mallocs "$TMP_DIR/miss" "$P")" \
+        "$(count_mallocs "$TMP_DIR/miss_base" "$P")" 2)
+    US=$(per_command "$(best_us "$TMP_DIR/miss" "$P")" "$MISS_US" 1)
+    printf '%8s %12s %12s %12s\n' "$SIZE" "$HIT" "$MISS" "$US"
+done
@@ -0,0 +1,66 @@
+#!/bin/bash
+
+# Throughput of a three-stage pipeline for different pipe buffer sizes.
+#
+# The shell runs
+#   head -c <MiB>M /dev/zero | cat | cat | cat | wc -c
+# with MINISHELL_PIPESIZE unset (the system default of 64 KiB) and then
+# set to each given size. Every run is checked to have moved all the
+# bytes; the best of three is reported in milliseconds and MiB/s.
+#
+# Usage: tests/bench_pipe_size.sh [minishell] [MiB] [pipe size ...]
+
+MINISHELL_PATH=$(realpath "${1:-./minishell}")
+MIB=${2:-1024}
+shift $(( $# < 2 ? $# : 2 ))
+SIZES=${*:-256K 1M}
+
+if [ ! -x "$MINISHELL_PATH" ]; then
+    echo "Minishell executable not found or not executable at $MINISHELL_PATH"
+    exit 1
+fi
+
+TMP_DIR=$(mktemp -d)
+trap 'rm -rf "$TMP_DIR"' EXIT
+echo "head -c ${MIB}M /dev/zero | cat | cat | cat | wc -c" > "$TMP_DIR/script"
+STATUS=0
+
+# Prints the best of three run times with MINISHELL_PIPESIZE=$1 (unset if
+# empty), in microseconds, or FAIL if a run lost bytes.
+best_us() {
+    local best=0 start end us i
+    local -a size=()
+    if [ -n "$1" ]; then
+        size=(MINISHELL_PIPESIZE="$1")
+    fi
+    for i in 1 2 3; do
+        start=$(date +%s%N)
+        (cd "$TMP_DIR" && env -i PATH=/usr/bin:/bin HOME="$TMP_DIR" \
+            "${size[@]}" "$MINISHELL_PATH" < "$TMP_DIR/script" \
+            > "$TMP_DIR/out" 2>&1)
+        end=$(date +%s%N)
+        if [ "$(head -n 1 "$TMP_DIR/out")" != $(( MIB << 20 )) ]; then
+            echo "FAIL"
+            return
+        fi
+        us=$(( (end - start) / 1000 ))
+        if (( best == 0 || us < best )); then
+            best=$us
+        fi
+    done
+    echo "$best"
+}
+
+printf '%10s %10s %10s\n' "pipe size" "ms" "MiB/s"
+for SIZE in "" $SIZES; do
+    US=$(best_us "$SIZE")
+    if [ "$US" = "FAIL" ]; then
+        printf '%10s %10s\n' "${SIZE:-default}" "FAIL"
+        head -n 3 "$TMP_DIR/out"
+        STATUS=1
+        continue
+    fi
+    printf '%10s %10s %10s\n' "${SIZE:-default}" "$(( US / 1000 ))" \
+        "$(( (MIB * 1000000) / US ))"
+done
+exit "$STATUS"
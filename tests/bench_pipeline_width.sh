@@ -0,0 +1,103 @@
+#!/bin/bash
+
+# Run time of wide pipelines, and the open file budget they are held to.
+#
+# For each size the shell runs one line of
+#   echo hi | cat | cat | ... | cat      (STAGES cats)
+# three times; the best time is reported in milliseconds and per stage in
+# microseconds, after checking that `hi` came out of the last stage.
+# Time per stage should stay about flat as the pipeline widens.
+#
+# Then, under `ulimit -n 64`, a pipeline of here-document stages
+#   cat <<E0 | cat <<E1 | ... | cat <<E<n>
+# is run with exactly as many stages as fit: stdio, one descriptor per
+# here-document and PIPE_FD_RESERVE (3) for the stage being started.
+# It must run, and one stage more must be refused up front.
+#
+# Usage: tests/bench_pipeline_width.sh [minishell] [stages ...]
+
+MINISHELL_PATH=$(realpath "${1:-./minishell}")
+shift $(( $# < 1 ? $# : 1 ))
+SIZES=${*:-10 1000 10000}
+FD_LIMIT=64
+FD_RESERVE=3
+
+if [ ! -x "$MINISHELL_PATH" ]; then
+    echo "Minishell executable not found or not executable at $MINISHELL_PATH"
+    exit 1
+fi
+
+TMP_DIR=$(mktemp -d)
+trap 'rm -rf "$TMP_DIR"' EXIT
+STATUS=0
+
+# Runs script $1 and leaves its output in $TMP_DIR/out.
+run_script() {
+    (cd "$TMP_DIR" && env -i PATH=/usr/bin:/bin HOME="$TMP_DIR" \
+        "$MINISHELL_PATH" < "$1" > "$TMP_DIR/out" 2>&1)
+}
+
+# Prints the best of three run times of script $1, in microseconds.
+best_us() {
+    local best=0 start end us i
+    for i in 1 2 3; do
+        start=$(date +%s%N)
+        run_script "$1"
+        end=$(date +%s%N)
+        us=$(( (end - start) / 1000 ))
+        if (( best == 0 || us < best )); then
+            best=$us
+        fi
+    done
+    echo "$best"
+}
+
+# Writes a pipeline of $1 heredoc stages, each body naming its stage.
+make_heredocs() {
+    local i line=""
+    for (( i = 0; i < $1; i++ )); do
+        line+="${line:+ | }cat <<E$i"
+    done
+    echo "$line"
+    for (( i = 0; i < $1; i++ )); do
+        printf 'stage %d\nE%d\n' "$i" "$i"
+    done
+}
+
+printf '%8s %12s %12s\n' "stages" "ms" "us/stage"
+for SIZE in $SIZES; do
+    LINE="echo hi"
+    for (( i = 0; i < SIZE; i++ )); do
+        LINE+=" | cat"
+    done
+    echo "$LINE" > "$TMP_DIR/wide"
+    US=$(best_us "$TMP_DIR/wide")
+    if [ "$(head -n 1 "$TMP_DIR/out")" != "hi" ]; then
+        printf '%8s %12s\n' "$SIZE" "FAIL"
+        head -n 3 "$TMP_DIR/out"
+        STATUS=1
+        continue
+    fi
+    printf '%8s %12s %12s\n' "$SIZE" "$(( US / 1000 ))" "$(( US / SIZE ))"
+done
+
+FIT=$(( FD_LIMIT - 3 - FD_RESERVE ))
+make_heredocs "$FIT" > "$TMP_DIR/fit"
+make_heredocs $(( FIT + 1 )) > "$TMP_DIR/over"
+(ulimit -n "$FD_LIMIT" && run_script "$TMP_DIR/fit")
+if [ "$(head -n 1 "$TMP_DIR/out")" = "stage $(( FIT - 1 ))" ]; then
+    echo "ulimit -n $FD_LIMIT: $FIT heredoc stages ran"
+else
+    echo "ulimit -n $FD_LIMIT: $FIT heredoc stages FAILED"
+    head -n 3 "$TMP_DIR/out"
+    STATUS=1
+fi
+(ulimit -n "$FD_LIMIT" && run_script "$TMP_DIR/over")
+if grep -q "exceeds the open file limit" "$TMP_DIR/out"; then
+    echo "ulimit -n $FD_LIMIT: $(( FIT + 1 )) heredoc stages refused"
+else
+    echo "ulimit -n $FD_LIMIT: $(( FIT + 1 )) heredoc stages NOT refused"
+    head -n 3 "$TMP_DIR/out"
+    STATUS=1
+fi
+exit "$STATUS"
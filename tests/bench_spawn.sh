@@ -0,0 +1,98 @@
+#!/bin/bash
+
+# Launch cost of a two-stage pipeline, posix_spawn path against fork path,
+# as the shell's resident set grows.
+#
+# A preloaded shim allocates and touches the given number of MiB in the
+# shell at startup, in small pages as a heap built from many allocations
+# would be, then drops itself from the environment so children do not
+# inherit it. For each size the shell runs PIPELINES copies of
+#   spawn: /bin/true | /bin/true
+#   fork:  /bin/true </dev/null | /bin/true </dev/null
+# (a redirection keeps a stage on the fork path; it costs one open()).
+# Each script runs three times and the best time counts. The time of an
+# empty run is subtracted, and the rest is reported per pipeline, in
+# microseconds.
+#
+# Usage: tests/bench_spawn.sh [minishell] [pipelines] [heap MiB ...]
+
+MINISHELL_PATH=$(realpath "${1:-./minishell}")
+PIPELINES=${2:-500}
+shift $(( $# < 2 ? $# : 2 ))
+SIZES=${*:-0 64 256 1024}
+
+if [ ! -x "$MINISHELL_PATH" ]; then
+    echo "Minishell executable not found or not executable at $MINISHELL_PATH"
+    exit 1
+fi
+
+TMP_DIR=$(mktemp -d)
+trap 'rm -rf "$TMP_DIR"' EXIT
+
+cat > "$TMP_DIR/grow.c" <<'SHIM'
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+__attribute__((constructor)) static void grow(void)
+{
+    const char *mib = getenv("BENCH_HEAP_MIB");
+    size_t size = (size_t)atol(mib ? mib : "0") << 20;
+    char *heap = NULL;
+
+    if (size && posix_memalign((void **)&heap, 4096, size) == 0)
+    {
+        madvise(heap, size, MADV_NOHUGEPAGE);
+        memset(heap, 1, size);
+    }
+    unsetenv("LD_PRELOAD");
+    unsetenv("BENCH_HEAP_MIB");
+}
+SHIM
+if ! cc -shared -fPIC -O2 -o "$TMP_DIR/grow.so" "$TMP_DIR/grow.c"; then
+    echo "Could not build the heap shim"
+    exit 1
+fi
+
+# Prints the run time of a script, in microseconds, with $2 MiB of heap.
+run_us() {
+    local start end
+    start=$(date +%s%N)
+    (cd "$TMP_DIR" && env -i PATH=/usr/bin:/bin BENCH_HEAP_MIB="$2" \
+        LD_PRELOAD="$TMP_DIR/grow.so" "$MINISHELL_PATH" < "$1" \
+        > /dev/null 2>&1)
+    end=$(date +%s%N)
+    echo $(( (end - start) / 1000 ))
+}
+
+# Prints the best of three runs of run_us.
+best_us() {
+    local best=0 us i
+    for i in 1 2 3; do
+        us=$(run_us "$1" "$2")
+        if (( best == 0 || us < best )); then
+            best=$us
+        fi
+    done
+    echo "$best"
+}
+
+# Writes $2 copies of line $1.
+make_script() {
+    local i
+    for (( i = 0; i < $2; i++ )); do
+        echo "$1"
+    done
+}
+
+make_script "" 0 > "$TMP_DIR/base"
+make_script "/bin/true | /bin/true" "$PIPELINES" > "$TMP_DIR/spawn"
+make_script "/bin/true </dev/null | /bin/true </dev/null" "$PIPELINES" \
+    > "$TMP_DIR/fork"
+printf '%8s %12s %12s\n' "heap MiB" "spawn us" "fork us"
+for SIZE in $SIZES; do
+    BASE=$(best_us "$TMP_DIR/base" "$SIZE")
+    SPAWN=$(( ($(best_us "$TMP_DIR/spawn" "$SIZE") - BASE) / PIPELINES ))
+    FORK=$(( ($(best_us "$TMP_DIR/fork" "$SIZE") - BASE) / PIPELINES ))
+    printf '%8s %12s %12s\n' "$SIZE" "$SPAWN" "$FORK"
+done
@@ -0,0 +1,67 @@
+#!/bin/bash
+
+# Checks that an exec'd command sees no descriptor of the shell's own.
+#
+# `ls -l /proc/self/fd` runs as a pipeline stage and as a single command,
+# with heredoc and `>` redirections, with and without the spawn helper
+# (MINISHELL_SPAWN_HELPER). Only 0, 1, 2 and the directory ls itself
+# opens to list /proc/self/fd may be open.
+#
+# Usage: tests/exec_fd_hygiene.sh [minishell]
+
+MINISHELL_PATH=$(realpath "${1:-./minishell}")
+
+if [ ! -x "$MINISHELL_PATH" ]; then
+    echo "Minishell executable not found or not executable at $MINISHELL_PATH"
+    exit 1
+fi
+
+TMP_DIR=$(mktemp -d)
+trap 'rm -rf "$TMP_DIR"' EXIT
+FAILED=0
+
+# Writes the minishell script for case $1; the listings go to $TMP_DIR.
+make_script() {
+    case "$1" in
+    pipeline)
+        printf '%s\n' 'cat <<A | ls -l /proc/self/fd <<B | cat > out' \
+            'a' 'A' 'b' 'B' ;;
+    pipeline_redir)
+        printf '%s\n' 'cat <<A | ls -l /proc/self/fd <<B > out | cat' \
+            'a' 'A' 'b' 'B' ;;
+    single)
+        printf '%s\n' 'ls -l /proc/self/fd <<A > out' 'a' 'A' ;;
+    esac
+}
+
+# Prints the fds of a listing that are neither 0-2 nor ls's own.
+stray_fds() {
+    awk '$(NF - 1) == "->" {
+        fd = $(NF - 2); target = $NF
+        if (fd > 2 && target !~ /^\/proc\/[0-9]+\/fd$/)
+            print fd " -> " target
+    }' "$1"
+}
+
+for HELPER in "" 1; do
+    for CASE in pipeline pipeline_redir single; do
+        rm -f "$TMP_DIR/out"
+        make_script "$CASE" > "$TMP_DIR/script"
+        (cd "$TMP_DIR" && env -i PATH=/usr/bin:/bin HOME="$TMP_DIR" \
+            ${HELPER:+MINISHELL_SPAWN_HELPER=$HELPER} "$MINISHELL_PATH" \
+            < script > /dev/null 2>&1)
+        NAME="$CASE${HELPER:+ (spawn helper)}"
+        STRAY=$(stray_fds "$TMP_DIR/out" 2>/dev/null)
+        if ! grep -q -- '-> ' "$TMP_DIR/out" 2>/dev/null; then
+            echo "FAIL: $NAME: no listing"
+            FAILED=1
+        elif [ -n "$STRAY" ]; then
+            echo "FAIL: $NAME: stray fds:"
+            echo "$STRAY"
+            FAILED=1
+        else
+            echo "OK: $NAME"
+        fi
+    done
+done
+exit $FAILED
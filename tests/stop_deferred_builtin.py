@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Stops a pipeline whose builtin first stage outgrows the pipe buffer.
+
+Runs minishell under a pty with ~200 KB of environment, starts
+`env | sleep 3`, presses Ctrl-Z while env is still writing, and checks
+that the prompt comes back with a stopped job that `fg` can finish.
+
+Usage: tests/stop_deferred_builtin.py [path/to/minishell]
+Exits 0 on success, 1 on failure.
+"""
+import os
+import pty
+import select
+import signal
+import sys
+import time
+
+PROMPT = b'minishell: '
+binary = sys.argv[1] if len(sys.argv) > 1 else './minishell'
+env = {'PATH': '/usr/bin:/bin', 'HOME': os.environ.get('HOME', '/'),
+       'TERM': 'dumb'}
+for i in range(10):
+    env['BIG%d' % i] = 'x' * 20000
+
+pid, fd = pty.fork()
+if pid == 0:
+    os.execve(binary, [binary], env)
+out = b''
+
+
+def read_until(pred, timeout):
+    global out
+    end = time.time() + timeout
+    while not pred() and time.time() < end:
+        r, _, _ = select.select([fd], [], [], 0.05)
+        if r:
+            try:
+                data = os.read(fd, 65536)
+            except OSError:
+                break
+            if not data:
+                break
+            out += data
+    return pred()
+
+
+def prompts(n):
+    return lambda: out.count(PROMPT) >= n
+
+
+def fail(msg):
+    os.kill(pid, signal.SIGKILL)
+    os.waitpid(pid, 0)
+    sys.stderr.write('FAIL: %s\n--- output ---\n%s\n'
+                     % (msg, out.decode(errors='replace')[-2000:]))
+    sys.exit(1)
+
+
+if not read_until(prompts(1), 3):
+    fail('no prompt')
+os.write(fd, b'env | sleep 3\n')
+time.sleep(0.5)
+os.write(fd, b'\x1a')
+if not read_until(prompts(2), 2):
+    fail('Ctrl-Z did not bring the prompt back')
+os.write(fd, b'jobs\n')
+if not read_until(prompts(3), 2) or b'Stopped' not in out:
+    fail('the job is not listed as stopped')
+os.write(fd, b'fg\n')
+if not read_until(prompts(4), 10):
+    fail('fg did not finish the job')
+os.write(fd, b'echo rc=$?\n')
+if not read_until(lambda: b'rc=0' in out, 2):
+    fail('unexpected status after fg')
+os.write(fd, b'exit\n')
+read_until(lambda: False, 1)
+os.waitpid(pid, 0)
+print('OK')